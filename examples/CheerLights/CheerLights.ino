@@ -31,19 +31,27 @@ TCPClient client;
 */
 unsigned long cheerLightsChannelNumber = 1417;
 
+// Remembers the last CheerLights entry seen, so unchanged colors are not downloaded again
+pollState cheerLights;
+
 void setup() {
   ThingSpeak.begin(client);
+  ThingSpeak.beginPoll(cheerLights, cheerLightsChannelNumber, TS_SELECT_FIELD(1), NULL);
 }
 
 void loop() {
-  // Read the latest value from field 1 of channel 1417
-  String color = ThingSpeak.readStringField(cheerLightsChannelNumber, 1);
-  setColor(color);
+  // Check field 1 of channel 1417 for a new color; newColor() is only called when it changes
+  ThingSpeak.poll(cheerLights, newColor, NULL);
 
   // Check again in 5 seconds
   delay(5000);
 }
 
+void newColor(unsigned long channelNumber, long entryID, void * context)
+{
+  setColor(ThingSpeak.getFieldAsString(1));
+}
+
 // List of CheerLights color names
 String colorName[] = {"none","red","pink","green","blue","cyan","white","warmwhite","oldlace","purple","magenta","yellow","orange"};
 
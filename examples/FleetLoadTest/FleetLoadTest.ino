@@ -0,0 +1,161 @@
+/*
+  FleetLoadTest
+
+  Simulates a fleet of devices writing to and reading from their own channels on a local ThingSpeak emulator,
+  and prints the throughput, latency percentiles and error rates every 10 seconds.  No request goes to the
+  real service, so the library settings of a fleet (batch size, clients, rate limits, circuit breaker, deadlines)
+  can be tried against slow or failing servers before they are rolled out.
+
+  Each simulated device is one channel.  Every round, each device stages an update and all of them are sent
+  with writeBatch(), and a few devices read back their latest value with readBatch().  The emulator runs on the
+  same device as the sketch, so RAM limits the fleet to a few dozen channels; lower DEVICE_COUNT if the sketch
+  runs out of memory.
+  extras/host/FleetLoadTest.cpp is a build of this test for Linux that simulates thousands of devices.
+
+  ThingSpeak ( https://www.thingspeak.com ) is an analytic IoT platform service that allows you to aggregate, visualize and analyze live data streams in the cloud.
+
+  Copyright 2025, The MathWorks, Inc.
+
+  Documentation for the ThingSpeak Communication Library for Particle is in the README.md file where the library was installed.
+  See the accompanying license file for licensing information.
+*/
+
+#define DEVICE_COUNT          32         // Simulated devices, one channel each
+#define TS_EMULATOR_CHANNELS  DEVICE_COUNT
+#define TS_EMULATOR_FEED_LENGTH 2
+
+#include "ThingSpeak.h"
+#include "ThingSpeakEmulator.h"
+
+#define CLIENT_COUNT          TS_READ_POOL_MAX
+#define READS_PER_ROUND       4          // Devices that read their latest value each round
+#define WRITE_INTERVAL_MS     1000       // Shortest time between updates of a channel, on the emulator and the devices
+#define REPORT_INTERVAL_MS    10000
+#define LATENCY_BUCKET_MS     10
+#define LATENCY_BUCKETS       (TIMEOUT_MS_SERVERRESPONSE / LATENCY_BUCKET_MS + 1)
+
+ThingSpeakEmulator emulator;
+ThingSpeakEmulatedClient clients[CLIENT_COUNT];
+Client * clientPointers[CLIENT_COUNT];
+
+char writeAPIKeys[DEVICE_COUNT][8];
+channelUpdate updates[DEVICE_COUNT];
+readRequest reads[READS_PER_ROUND];
+
+// Results since the last report
+unsigned long requestCount = 0;
+unsigned long succeeded = 0;
+unsigned long rateLimited = 0;       // -401, the emulator did not store the update
+unsigned long timedOut = 0;          // -304 and -306
+unsigned long connectFailed = 0;     // -301 and -305
+unsigned long otherErrors = 0;
+unsigned long latencyCounts[LATENCY_BUCKETS];
+unsigned long reportStartedAt = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  // A server 50 to 400 ms away that refuses 1% of connections, fails 1% of requests and never answers 1% of them
+  emulator.setLatency(50, 400);
+  emulator.setFailures(1, 1, 1);
+  emulator.setRateLimit(WRITE_INTERVAL_MS);
+
+  for(unsigned int i = 0; i < CLIENT_COUNT; i++)
+  {
+    clients[i].attach(&emulator);
+    clientPointers[i] = &clients[i];
+  }
+  ThingSpeak.begin(clients[0]);
+
+  for(unsigned int device = 0; device < DEVICE_COUNT; device++)
+  {
+    snprintf(writeAPIKeys[device], sizeof(writeAPIKeys[device]), "W%05u", device);
+    emulator.addChannel(device + 1, writeAPIKeys[device], NULL);
+    ThingSpeak.beginChannelUpdate(updates[device], device + 1, writeAPIKeys[device], WRITE_INTERVAL_MS);
+  }
+  reportStartedAt = millis();
+}
+
+void loop() {
+  // Every device stages a new reading
+  for(unsigned int device = 0; device < DEVICE_COUNT; device++)
+  {
+    ThingSpeak.setField(1, (float)random(0, 3300) / 1000);
+    ThingSpeak.setField(2, (long)device);
+    ThingSpeak.stageChannelUpdate(updates[device]);
+  }
+  ThingSpeak.writeBatch(updates, DEVICE_COUNT, clientPointers, CLIENT_COUNT);
+  for(unsigned int device = 0; device < DEVICE_COUNT; device++)
+  {
+    recordResult(updates[device].status, updates[device].elapsedMs);
+  }
+
+  // A few devices read back their latest value
+  for(unsigned int i = 0; i < READS_PER_ROUND; i++)
+  {
+    reads[i].channelNumber = random(1, DEVICE_COUNT + 1);
+    reads[i].field = 1;
+    reads[i].URLSuffix = NULL;
+    reads[i].readAPIKey = NULL;
+  }
+  ThingSpeak.readBatch(reads, READS_PER_ROUND, clientPointers, CLIENT_COUNT);
+  for(unsigned int i = 0; i < READS_PER_ROUND; i++)
+  {
+    recordResult(reads[i].status, reads[i].elapsedMs);
+  }
+
+  if(millis() - reportStartedAt >= REPORT_INTERVAL_MS)
+  {
+    printReport();
+  }
+}
+
+void recordResult(int status, unsigned long elapsedMs) {
+  if(status == TS_ERR_RATE_LIMITED)
+  {
+    // Held back by the device, nothing was sent
+    return;
+  }
+  requestCount++;
+  switch(status)
+  {
+    case TS_OK_SUCCESS: succeeded++; break;
+    case TS_ERR_NOT_INSERTED: rateLimited++; break;
+    case TS_ERR_TIMEOUT: case TS_ERR_DEADLINE_EXCEEDED: timedOut++; break;
+    case TS_ERR_CONNECT_FAILED: case TS_ERR_CIRCUIT_OPEN: connectFailed++; break;
+    default: otherErrors++; break;
+  }
+  unsigned long bucket = elapsedMs / LATENCY_BUCKET_MS;
+  latencyCounts[(bucket < LATENCY_BUCKETS) ? bucket : LATENCY_BUCKETS - 1]++;
+}
+
+// Latency below which percent of the requests finished
+unsigned long latencyPercentile(unsigned int percent) {
+  unsigned long target = (requestCount * percent + 99) / 100;
+  unsigned long seen = 0;
+  for(unsigned long bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+  {
+    seen += latencyCounts[bucket];
+    if(seen >= target && seen > 0)
+    {
+      return (bucket + 1) * LATENCY_BUCKET_MS;
+    }
+  }
+  return 0;
+}
+
+void printReport() {
+  unsigned long elapsedMs = millis() - reportStartedAt;
+  float perCent = (requestCount > 0) ? 100.0 / requestCount : 0;
+  Serial.printlnf("%lu requests in %lu ms, %.1f per second", requestCount, elapsedMs, requestCount * 1000.0 / elapsedMs);
+  Serial.printlnf("latency p50 %lu ms, p90 %lu ms, p99 %lu ms", latencyPercentile(50), latencyPercentile(90), latencyPercentile(99));
+  Serial.printlnf("ok %.1f%%, not stored %.1f%%, timed out %.1f%%, connect failed %.1f%%, other %.1f%%",
+                  succeeded * perCent, rateLimited * perCent, timedOut * perCent, connectFailed * perCent, otherErrors * perCent);
+  Serial.printlnf("emulator: %lu requests, %lu entries stored, %lu rate limited, circuit breaker %u",
+                  emulator.getRequests(), emulator.getEntriesStored(), emulator.getRateLimited(), ThingSpeak.getCircuitState());
+
+  requestCount = succeeded = rateLimited = timedOut = connectFailed = otherErrors = 0;
+  memset(latencyCounts, 0, sizeof(latencyCounts));
+  emulator.resetCounts();
+  reportStartedAt = millis();
+}
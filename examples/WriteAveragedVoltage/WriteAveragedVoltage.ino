@@ -0,0 +1,55 @@
+/*
+  WriteAveragedVoltage
+  
+  Samples an analog voltage from pin 0 ten times a second, and every 20 seconds writes the mean to field 1
+  and the maximum to field 2 of a channel on ThingSpeak, with the minimum and maximum in the status.
+  
+  ThingSpeak ( https://www.thingspeak.com ) is an analytic IoT platform service that allows you to aggregate, visualize and analyze live data streams in the cloud.
+  
+  Copyright 2025, The MathWorks, Inc.
+
+  Documentation for the ThingSpeak Communication Library for Particle is in the README.md file where the library was installed.
+  See the accompanying license file for licensing information.
+*/
+
+#include "ThingSpeak.h"
+
+TCPClient client;
+
+/*
+  *****************************************************************************************
+  **** Visit https://www.thingspeak.com to sign up for a free account and create
+  **** a channel.  The video tutorial http://community.thingspeak.com/tutorials/thingspeak-channels/ 
+  **** has more information. You need to change this to your channel, and your write API key
+  **** IF YOU SHARE YOUR CODE WITH OTHERS, MAKE SURE YOU REMOVE YOUR WRITE API KEY!!
+  *****************************************************************************************/
+unsigned long myChannelNumber = 31461;
+const char * myWriteAPIKey = "LD79EOAAWRVYF04Y";
+
+unsigned long lastWriteAt = 0;
+
+void setup() {
+  ThingSpeak.begin(client);
+  // Field 1 gets the mean (the default), field 2 the maximum, and the minimum and maximum of field 1 go in the status
+  ThingSpeak.setSampleReduction(1, TS_REDUCE_MINMAX_STATUS);
+  ThingSpeak.setSampleReduction(2, TS_REDUCE_MAX);
+}
+
+void loop() {
+  // read the input on analog pin 0:
+  int sensorValue = analogRead(A0);
+  // Convert the analog reading 
+  // On Particle: 0 - 4095 maps to 0 - 3.3 volts
+  float voltage = sensorValue * (3.3 / 4095.0);
+
+  // Only the running statistics are kept, however many samples are added
+  ThingSpeak.addSample(1, voltage);
+  ThingSpeak.addSample(2, voltage);
+
+  if(millis() - lastWriteAt >= 20000) // ThingSpeak will only accept updates every 15 seconds.
+  {
+    ThingSpeak.writeFields(myChannelNumber, myWriteAPIKey);
+    lastWriteAt = millis();
+  }
+  delay(100);
+}
@@ -0,0 +1,107 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  Runs the ThingSpeak emulator as a local server on Linux, so devices, host builds of the library and load
+  generators can use it over the network instead of the real service.  Channel n (1 to the channel count) is
+  public with the write API key "W" followed by n - 1 in five digits, the keys the FleetLoadTest host build uses.
+  Prints the emulator counts every 10 seconds until it is stopped.
+
+  Build and run from the root of the library:
+    g++ -std=gnu++14 -O2 -DPLATFORM_ID=12 -Iextras/host -Isrc extras/host/EmulatorHost.cpp -o EmulatorHost -pthread
+    ./EmulatorHost -p 8080 -c 2000 -l 50,400 -f 1,1,1 -r 1000
+
+  Options:
+    -p port          TCP port, 8080 by default
+    -c channels      Channels to add, up to TS_EMULATOR_CHANNELS (4096)
+    -l min,max       Response latency in milliseconds, 0 by default
+    -f c,e,d         Percent of connections refused, requests answered with 500, and requests never answered
+    -r intervalMs    Shortest time between updates of a channel, TS_RATE_LIMIT_MS (15000) by default
+    -a               Listen on every address instead of 127.0.0.1 only, to serve devices on the network
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#define TS_EMULATOR_CHANNELS       4096
+#define TS_EMULATOR_FEED_LENGTH    4
+
+#include "EmulatorServer.h"
+
+#include <csignal>
+#include <getopt.h>
+
+#define REPORT_INTERVAL_MS         10000
+
+static ThingSpeakEmulator emulator;
+static ThingSpeakEmulatorServer server(emulator);
+static char writeAPIKeys[TS_EMULATOR_CHANNELS][8];
+static volatile sig_atomic_t stopping = 0;
+
+static void onSignal(int)
+{
+    stopping = 1;
+}
+
+int main(int argc, char ** argv)
+{
+    unsigned int port = 8080;
+    unsigned long channelCount = 16;
+    bool anyAddress = false;
+    int option;
+    while((option = getopt(argc, argv, "p:c:l:f:r:a")) != -1)
+    {
+        unsigned long first = 0, second = 0, third = 0;
+        switch(option)
+        {
+            case 'p': port = strtoul(optarg, NULL, 10); break;
+            case 'c': channelCount = strtoul(optarg, NULL, 10); break;
+            case 'l': sscanf(optarg, "%lu,%lu", &first, &second); emulator.setLatency(first, second); break;
+            case 'f': sscanf(optarg, "%lu,%lu,%lu", &first, &second, &third); emulator.setFailures(first, second, third); break;
+            case 'r': emulator.setRateLimit(strtoul(optarg, NULL, 10)); break;
+            case 'a': anyAddress = true; break;
+            default:
+                fprintf(stderr, "usage: %s [-p port] [-c channels] [-l min,max] [-f connect,error,drop] [-r intervalMs] [-a]\n", argv[0]);
+                return 2;
+        }
+    }
+    if(channelCount < 1 || channelCount > TS_EMULATOR_CHANNELS)
+    {
+        fprintf(stderr, "channels must be 1 to %u\n", TS_EMULATOR_CHANNELS);
+        return 2;
+    }
+
+    for(unsigned long channel = 1; channel <= channelCount; channel++)
+    {
+        snprintf(writeAPIKeys[channel - 1], sizeof(writeAPIKeys[channel - 1]), "W%05lu", channel - 1);
+        emulator.addChannel(channel, writeAPIKeys[channel - 1], NULL);
+    }
+    if(!server.start(port, anyAddress))
+    {
+        fprintf(stderr, "could not listen on port %u: %s\n", port, strerror(errno));
+        return 1;
+    }
+    printf("ThingSpeak emulator on port %u with channels 1 to %lu\n", server.getPort(), channelCount);
+    fflush(stdout);
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    unsigned long reportStartedAt = millis();
+    while(!stopping)
+    {
+        delay(100);
+        if(millis() - reportStartedAt < REPORT_INTERVAL_MS)
+        {
+            continue;
+        }
+        std::lock_guard<std::mutex> guard(server.getLock());
+        printf("%lu connections (%lu refused), %lu requests, %lu entries stored, %lu rate limited, %lu errors, %lu dropped\n",
+               emulator.getConnections(), emulator.getRefusedConnections(), emulator.getRequests(), emulator.getEntriesStored(),
+               emulator.getRateLimited(), emulator.getErrors(), emulator.getDropped());
+        fflush(stdout);
+        emulator.resetCounts();
+        reportStartedAt = millis();
+    }
+    server.stop();
+    return 0;
+}
@@ -0,0 +1,227 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  Serves a ThingSpeakEmulator on a Linux TCP port, so the library can reach it over real sockets with
+  LinuxTCPClient.  Each connection is answered on its own thread: the request is read up to its Content-Length,
+  passed to the emulator, and the response is sent after the latency the emulator picks, then the connection is
+  closed.  Refused connections are closed at once, and dropped requests are never answered.
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#ifndef EmulatorServer_h
+    #define EmulatorServer_h
+
+    #include "ThingSpeakEmulator.h"
+
+    #include <cerrno>
+    #include <unistd.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <netinet/in.h>
+    #include <arpa/inet.h>
+
+    #define TS_HOST_REQUEST_TIMEOUT_MS 10000  // A connection that sends no complete request in this time is closed
+
+    class ThingSpeakEmulatorServer
+    {
+      public:
+        ThingSpeakEmulatorServer(ThingSpeakEmulator & emulator) : emulator(emulator)
+        {
+            this->listener = -1;
+            this->port = 0;
+            this->running.store(false);
+            this->open.store(0);
+        }
+
+        ~ThingSpeakEmulatorServer()
+        {
+            stop();
+        }
+
+        // Listens on 127.0.0.1, or on every address if anyAddress, port 0 picks a free port
+        bool start(uint16_t port, bool anyAddress = false)
+        {
+            this->listener = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            if(this->listener < 0)
+            {
+                return false;
+            }
+            int reuse = 1;
+            ::setsockopt(this->listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+            struct sockaddr_in address;
+            memset(&address, 0, sizeof(address));
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(anyAddress ? INADDR_ANY : INADDR_LOOPBACK);
+            address.sin_port = htons(port);
+            socklen_t length = sizeof(address);
+            if(::bind(this->listener, (struct sockaddr *)&address, sizeof(address)) != 0 || ::listen(this->listener, SOMAXCONN) != 0 ||
+               ::getsockname(this->listener, (struct sockaddr *)&address, &length) != 0)
+            {
+                ::close(this->listener);
+                this->listener = -1;
+                return false;
+            }
+            this->port = ntohs(address.sin_port);
+            this->running.store(true);
+            this->acceptor = std::thread(&ThingSpeakEmulatorServer::acceptConnections, this);
+            return true;
+        }
+
+        // Stops accepting and waits for the open connections to finish
+        void stop()
+        {
+            if(!this->running.exchange(false))
+            {
+                return;
+            }
+            ::shutdown(this->listener, SHUT_RDWR);
+            this->acceptor.join();
+            ::close(this->listener);
+            this->listener = -1;
+            while(this->open.load() > 0)
+            {
+                delay(1);
+            }
+        }
+
+        uint16_t getPort()
+        {
+            return this->port;
+        }
+
+        // The emulator is not thread safe, so hold this lock to configure it or read its counts while serving
+        std::mutex & getLock()
+        {
+            return this->lock;
+        }
+
+      private:
+        void acceptConnections()
+        {
+            while(this->running.load())
+            {
+                struct pollfd ready = {this->listener, POLLIN, 0};
+                if(::poll(&ready, 1, 100) <= 0)
+                {
+                    continue;
+                }
+                int connection = ::accept4(this->listener, NULL, NULL, SOCK_CLOEXEC);
+                if(connection < 0)
+                {
+                    continue;
+                }
+                this->open++;
+                std::thread(&ThingSpeakEmulatorServer::serve, this, connection).detach();
+            }
+        }
+
+        void serve(int connection)
+        {
+            bool accepted;
+            {
+                std::lock_guard<std::mutex> guard(this->lock);
+                accepted = this->emulator.acceptConnection();
+            }
+            String request;
+            if(accepted && readRequest(connection, request))
+            {
+                String response;
+                bool answered;
+                unsigned long latency;
+                {
+                    std::lock_guard<std::mutex> guard(this->lock);
+                    answered = this->emulator.respond(request, response);
+                    latency = this->emulator.pickLatency();
+                }
+                if(answered)
+                {
+                    delay(latency);
+                    sendAll(connection, response);
+                }
+                else
+                {
+                    // Never answered, the client gives up on its own timeout
+                    waitForClose(connection);
+                }
+            }
+            ::close(connection);
+            this->open--;
+        }
+
+        // Reads the headers and Content-Length bytes of body, false if the client closes or stalls first
+        bool readRequest(int connection, String & request)
+        {
+            unsigned long startedAt = millis();
+            std::string received;
+            char buffer[512];
+            while(millis() - startedAt < TS_HOST_REQUEST_TIMEOUT_MS)
+            {
+                size_t headersEnd = received.find("\r\n\r\n");
+                if(headersEnd != std::string::npos)
+                {
+                    String headers(received.substr(0, headersEnd));
+                    headers.toLowerCase();
+                    int lengthHeader = headers.indexOf("content-length:");
+                    long contentLength = (lengthHeader < 0) ? 0 : headers.substring(lengthHeader + 15).toInt();
+                    if((long)(received.size() - headersEnd - 4) >= contentLength)
+                    {
+                        request = String(received);
+                        return true;
+                    }
+                }
+                struct pollfd ready = {connection, POLLIN, 0};
+                if(::poll(&ready, 1, 100) <= 0)
+                {
+                    continue;
+                }
+                ssize_t length = ::recv(connection, buffer, sizeof(buffer), 0);
+                if(length <= 0)
+                {
+                    return false;
+                }
+                received.append(buffer, length);
+            }
+            return false;
+        }
+
+        void sendAll(int connection, const String & response)
+        {
+            size_t sent = 0;
+            while(sent < response.length())
+            {
+                ssize_t length = ::send(connection, response.c_str() + sent, response.length() - sent, MSG_NOSIGNAL);
+                if(length <= 0)
+                {
+                    return;
+                }
+                sent += length;
+            }
+        }
+
+        void waitForClose(int connection)
+        {
+            char buffer[64];
+            unsigned long startedAt = millis();
+            while(this->running.load() && millis() - startedAt < TS_HOST_REQUEST_TIMEOUT_MS)
+            {
+                struct pollfd ready = {connection, POLLIN, 0};
+                if(::poll(&ready, 1, 100) > 0 && ::recv(connection, buffer, sizeof(buffer), 0) <= 0)
+                {
+                    return;
+                }
+            }
+        }
+
+        ThingSpeakEmulator & emulator;
+        std::mutex lock;
+        int listener;
+        uint16_t port;
+        std::thread acceptor;
+        std::atomic<bool> running;
+        std::atomic<int> open;             // Connections still being served
+    };
+
+#endif //EmulatorServer_h
@@ -0,0 +1,256 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  Host build of the FleetLoadTest example.  Simulates thousands of devices writing to and reading from their own
+  channels over real sockets, and prints the throughput, latency percentiles and error rates every 10 seconds.
+  The devices are split between worker threads.  Each worker is one ThingSpeak object with TS_READ_POOL_MAX
+  LinuxTCPClient connections, and every round it stages an update for each of its devices, sends them with
+  writeBatch() and reads back the latest value of a few of them with readBatch().
+
+  By default the emulator is served in the same process.  With -H, the devices use an emulator already running
+  elsewhere, such as EmulatorHost, which must have at least as many channels as there are devices.
+
+  Build and run from the root of the library:
+    g++ -std=gnu++14 -O2 -DPLATFORM_ID=12 -Iextras/host -Isrc extras/host/FleetLoadTest.cpp -o FleetLoadTest -pthread
+    ./FleetLoadTest -d 2000 -w 16 -s 30
+
+  Options:
+    -d devices       Simulated devices, one channel each, 2000 by default and up to TS_EMULATOR_CHANNELS (4096)
+    -w workers       Worker threads, 16 by default
+    -s seconds       How long to run, 30 by default
+    -H host          Emulator to use instead of serving one in this process
+    -p port          Port of the emulator given with -H, 8080 by default
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#define TS_EMULATOR_CHANNELS       4096
+#define TS_EMULATOR_FEED_LENGTH    2
+
+#include "EmulatorServer.h"
+#include "LinuxTCPClient.h"
+
+#include <vector>
+#include <getopt.h>
+
+#define CLIENT_COUNT          TS_READ_POOL_MAX
+#define READS_PER_ROUND       4          // Devices of each worker that read their latest value each round
+#define WRITE_INTERVAL_MS     1000       // Shortest time between updates of a channel, on the emulator and the devices
+#define REPORT_INTERVAL_MS    10000
+#define LATENCY_BUCKET_MS     10
+#define LATENCY_BUCKETS       (TIMEOUT_MS_SERVERRESPONSE / LATENCY_BUCKET_MS + 1)
+
+static ThingSpeakEmulator emulator;
+static ThingSpeakEmulatorServer server(emulator);
+static char writeAPIKeys[TS_EMULATOR_CHANNELS][8];
+
+static const char * serverHost = "127.0.0.1";
+static unsigned int serverPort = 8080;
+static std::atomic<bool> running(true);
+
+// Results since the last report, shared by the workers
+static std::mutex resultsLock;
+static unsigned long requestCount = 0;
+static unsigned long succeeded = 0;
+static unsigned long rateLimited = 0;       // -401, the emulator did not store the update
+static unsigned long timedOut = 0;          // -304 and -306
+static unsigned long connectFailed = 0;     // -301 and -305
+static unsigned long otherErrors = 0;
+static unsigned long latencyCounts[LATENCY_BUCKETS];
+
+static void recordResult(int status, unsigned long elapsedMs)
+{
+    if(status == TS_ERR_RATE_LIMITED)
+    {
+        // Held back by the device, nothing was sent
+        return;
+    }
+    std::lock_guard<std::mutex> guard(resultsLock);
+    requestCount++;
+    switch(status)
+    {
+        case TS_OK_SUCCESS: succeeded++; break;
+        case TS_ERR_NOT_INSERTED: rateLimited++; break;
+        case TS_ERR_TIMEOUT: case TS_ERR_DEADLINE_EXCEEDED: timedOut++; break;
+        case TS_ERR_CONNECT_FAILED: case TS_ERR_CIRCUIT_OPEN: connectFailed++; break;
+        default: otherErrors++; break;
+    }
+    unsigned long bucket = elapsedMs / LATENCY_BUCKET_MS;
+    latencyCounts[(bucket < LATENCY_BUCKETS) ? bucket : LATENCY_BUCKETS - 1]++;
+}
+
+// Latency below which percent of the requests finished
+static unsigned long latencyPercentile(unsigned int percent)
+{
+    unsigned long target = (requestCount * percent + 99) / 100;
+    unsigned long seen = 0;
+    for(unsigned long bucket = 0; bucket < LATENCY_BUCKETS; bucket++)
+    {
+        seen += latencyCounts[bucket];
+        if(seen >= target && seen > 0)
+        {
+            return (bucket + 1) * LATENCY_BUCKET_MS;
+        }
+    }
+    return 0;
+}
+
+static void printReport(unsigned long elapsedMs, bool local)
+{
+    std::lock_guard<std::mutex> guard(resultsLock);
+    float perCent = (requestCount > 0) ? 100.0 / requestCount : 0;
+    printf("%lu requests in %lu ms, %.1f per second\n", requestCount, elapsedMs, requestCount * 1000.0 / elapsedMs);
+    printf("latency p50 %lu ms, p90 %lu ms, p99 %lu ms\n", latencyPercentile(50), latencyPercentile(90), latencyPercentile(99));
+    printf("ok %.1f%%, not stored %.1f%%, timed out %.1f%%, connect failed %.1f%%, other %.1f%%\n",
+           succeeded * perCent, rateLimited * perCent, timedOut * perCent, connectFailed * perCent, otherErrors * perCent);
+    if(local)
+    {
+        std::lock_guard<std::mutex> emulatorGuard(server.getLock());
+        printf("emulator: %lu requests, %lu entries stored, %lu rate limited\n",
+               emulator.getRequests(), emulator.getEntriesStored(), emulator.getRateLimited());
+        emulator.resetCounts();
+    }
+    fflush(stdout);
+
+    requestCount = succeeded = rateLimited = timedOut = connectFailed = otherErrors = 0;
+    memset(latencyCounts, 0, sizeof(latencyCounts));
+}
+
+// Runs the devices firstDevice to firstDevice + deviceCount - 1 until the test ends
+static void runWorker(unsigned int firstDevice, unsigned int deviceCount)
+{
+    ThingSpeakClass thingSpeak;
+    LinuxTCPClient clients[CLIENT_COUNT];
+    Client * clientPointers[CLIENT_COUNT];
+    for(unsigned int i = 0; i < CLIENT_COUNT; i++)
+    {
+        clients[i].redirect(serverHost, serverPort);
+        clientPointers[i] = &clients[i];
+    }
+    thingSpeak.begin(clients[0]);
+
+    std::vector<channelUpdate> updates(deviceCount);
+    for(unsigned int i = 0; i < deviceCount; i++)
+    {
+        unsigned int device = firstDevice + i;
+        thingSpeak.beginChannelUpdate(updates[i], device + 1, writeAPIKeys[device], WRITE_INTERVAL_MS);
+    }
+    readRequest reads[READS_PER_ROUND];
+
+    while(running.load())
+    {
+        // Every device stages a new reading
+        for(unsigned int i = 0; i < deviceCount; i++)
+        {
+            thingSpeak.setField(1, (float)random(0, 3300) / 1000);
+            thingSpeak.setField(2, (long)(firstDevice + i));
+            thingSpeak.stageChannelUpdate(updates[i]);
+        }
+        thingSpeak.writeBatch(updates.data(), deviceCount, clientPointers, CLIENT_COUNT);
+        for(unsigned int i = 0; i < deviceCount; i++)
+        {
+            recordResult(updates[i].status, updates[i].elapsedMs);
+        }
+
+        // A few devices read back their latest value
+        for(unsigned int i = 0; i < READS_PER_ROUND; i++)
+        {
+            reads[i].channelNumber = firstDevice + random(0, deviceCount) + 1;
+            reads[i].field = 1;
+            reads[i].URLSuffix = NULL;
+            reads[i].readAPIKey = NULL;
+        }
+        thingSpeak.readBatch(reads, READS_PER_ROUND, clientPointers, CLIENT_COUNT);
+        for(unsigned int i = 0; i < READS_PER_ROUND; i++)
+        {
+            recordResult(reads[i].status, reads[i].elapsedMs);
+        }
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    unsigned int deviceCount = 2000;
+    unsigned int workerCount = 16;
+    unsigned long seconds = 30;
+    bool local = true;
+    int option;
+    while((option = getopt(argc, argv, "d:w:s:H:p:")) != -1)
+    {
+        switch(option)
+        {
+            case 'd': deviceCount = strtoul(optarg, NULL, 10); break;
+            case 'w': workerCount = strtoul(optarg, NULL, 10); break;
+            case 's': seconds = strtoul(optarg, NULL, 10); break;
+            case 'H': serverHost = optarg; local = false; break;
+            case 'p': serverPort = strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-d devices] [-w workers] [-s seconds] [-H host] [-p port]\n", argv[0]);
+                return 2;
+        }
+    }
+    if(deviceCount < 1 || deviceCount > TS_EMULATOR_CHANNELS || workerCount < 1 || workerCount > deviceCount)
+    {
+        fprintf(stderr, "devices must be 1 to %u, and workers 1 to the number of devices\n", TS_EMULATOR_CHANNELS);
+        return 2;
+    }
+
+    for(unsigned int device = 0; device < deviceCount; device++)
+    {
+        snprintf(writeAPIKeys[device], sizeof(writeAPIKeys[device]), "W%05u", device);
+    }
+    if(local)
+    {
+        // A server 50 to 400 ms away that refuses 1% of connections, fails 1% of requests and never answers 1% of them
+        emulator.setLatency(50, 400);
+        emulator.setFailures(1, 1, 1);
+        emulator.setRateLimit(WRITE_INTERVAL_MS);
+        for(unsigned int device = 0; device < deviceCount; device++)
+        {
+            emulator.addChannel(device + 1, writeAPIKeys[device], NULL);
+        }
+        if(!server.start(0))
+        {
+            fprintf(stderr, "could not listen on a local port\n");
+            return 1;
+        }
+        serverPort = server.getPort();
+    }
+    printf("%u devices on %u workers against %s:%u for %lu s\n", deviceCount, workerCount, serverHost, serverPort, seconds);
+
+    std::vector<std::thread> workers;
+    for(unsigned int worker = 0; worker < workerCount; worker++)
+    {
+        unsigned int first = deviceCount * worker / workerCount;
+        unsigned int last = deviceCount * (worker + 1) / workerCount;
+        workers.push_back(std::thread(runWorker, first, last - first));
+    }
+
+    unsigned long startedAt = millis();
+    unsigned long reportStartedAt = startedAt;
+    while(millis() - startedAt < seconds * 1000)
+    {
+        delay(100);
+        if(millis() - reportStartedAt >= REPORT_INTERVAL_MS)
+        {
+            printReport(millis() - reportStartedAt, local);
+            reportStartedAt = millis();
+        }
+    }
+    running.store(false);
+    for(std::thread & worker : workers)
+    {
+        worker.join();
+    }
+    if(millis() - reportStartedAt >= 1000)
+    {
+        printReport(millis() - reportStartedAt, local);
+    }
+    if(local)
+    {
+        server.stop();
+    }
+    return 0;
+}
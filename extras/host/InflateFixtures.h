@@ -0,0 +1,530 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  gzip streams decoded by InflateTest.cpp, written by make_inflate_fixtures.py.  Do not edit.
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#ifndef InflateFixtures_h
+    #define InflateFixtures_h
+
+    #include <stdint.h>
+
+    // The text the feed streams decode to
+    static const char inflateFeedText[] =
+        "{\"channel\":{\"id\":1234567,\"name\":\"Weather station\",\"latitude\":\"0.0\",\"longitude\":\"0.0\",\"field1\":\"Tempe"
+        "rature\",\"field2\":\"Humidity\",\"created_at\":\"2025-01-01T00:00:00Z\",\"updated_at\":\"2025-01-01T00:00:00Z\","
+        "\"last_entry_id\":40},\"feeds\":[{\"created_at\":\"2025-03-01T00:01:00Z\",\"entry_id\":1,\"field1\":\"21.29\",\"fie"
+        "ld2\":\"38\"},{\"created_at\":\"2025-03-01T00:02:00Z\",\"entry_id\":2,\"field1\":\"22.48\",\"field2\":\"39\"},{\"creat"
+        "ed_at\":\"2025-03-01T00:03:00Z\",\"entry_id\":3,\"field1\":\"19.72\",\"field2\":\"46\"},{\"created_at\":\"2025-03-01"
+        "T00:04:00Z\",\"entry_id\":4,\"field1\":\"21.40\",\"field2\":\"63\"},{\"created_at\":\"2025-03-01T00:05:00Z\",\"entry"
+        "_id\":5,\"field1\":\"22.53\",\"field2\":\"47\"},{\"created_at\":\"2025-03-01T00:06:00Z\",\"entry_id\":6,\"field1\":\"2"
+        "1.92\",\"field2\":\"67\"},{\"created_at\":\"2025-03-01T00:07:00Z\",\"entry_id\":7,\"field1\":\"23.58\",\"field2\":\"36"
+        "\"},{\"created_at\":\"2025-03-01T00:08:00Z\",\"entry_id\":8,\"field1\":\"20.19\",\"field2\":\"62\"},{\"created_at\":\""
+        "2025-03-01T00:09:00Z\",\"entry_id\":9,\"field1\":\"18.07\",\"field2\":\"61\"},{\"created_at\":\"2025-03-01T00:10:0"
+        "0Z\",\"entry_id\":10,\"field1\":\"20.25\",\"field2\":\"31\"},{\"created_at\":\"2025-03-01T00:11:00Z\",\"entry_id\":11"
+        ",\"field1\":\"20.05\",\"field2\":\"61\"},{\"created_at\":\"2025-03-01T00:12:00Z\",\"entry_id\":12,\"field1\":\"18.31\""
+        ",\"field2\":\"45\"},{\"created_at\":\"2025-03-01T00:13:00Z\",\"entry_id\":13,\"field1\":\"23.88\",\"field2\":\"35\"},{"
+        "\"created_at\":\"2025-03-01T00:14:00Z\",\"entry_id\":14,\"field1\":\"18.94\",\"field2\":\"40\"},{\"created_at\":\"202"
+        "5-03-01T00:15:00Z\",\"entry_id\":15,\"field1\":\"21.39\",\"field2\":\"60\"},{\"created_at\":\"2025-03-01T00:16:00Z"
+        "\",\"entry_id\":16,\"field1\":\"23.08\",\"field2\":\"35\"},{\"created_at\":\"2025-03-01T00:17:00Z\",\"entry_id\":17,\""
+        "field1\":\"19.76\",\"field2\":\"66\"},{\"created_at\":\"2025-03-01T00:18:00Z\",\"entry_id\":18,\"field1\":\"18.46\",\""
+        "field2\":\"38\"},{\"created_at\":\"2025-03-01T00:19:00Z\",\"entry_id\":19,\"field1\":\"21.28\",\"field2\":\"58\"},{\"c"
+        "reated_at\":\"2025-03-01T00:20:00Z\",\"entry_id\":20,\"field1\":\"23.83\",\"field2\":\"61\"},{\"created_at\":\"2025-"
+        "03-01T00:21:00Z\",\"entry_id\":21,\"field1\":\"19.94\",\"field2\":\"69\"},{\"created_at\":\"2025-03-01T00:22:00Z\","
+        "\"entry_id\":22,\"field1\":\"20.33\",\"field2\":\"46\"},{\"created_at\":\"2025-03-01T00:23:00Z\",\"entry_id\":23,\"fi"
+        "eld1\":\"22.66\",\"field2\":\"59\"},{\"created_at\":\"2025-03-01T00:24:00Z\",\"entry_id\":24,\"field1\":\"21.02\",\"fi"
+        "eld2\":\"32\"},{\"created_at\":\"2025-03-01T00:25:00Z\",\"entry_id\":25,\"field1\":\"23.33\",\"field2\":\"37\"},{\"cre"
+        "ated_at\":\"2025-03-01T00:26:00Z\",\"entry_id\":26,\"field1\":\"22.02\",\"field2\":\"65\"},{\"created_at\":\"2025-03"
+        "-01T00:27:00Z\",\"entry_id\":27,\"field1\":\"20.85\",\"field2\":\"34\"},{\"created_at\":\"2025-03-01T00:28:00Z\",\"e"
+        "ntry_id\":28,\"field1\":\"20.26\",\"field2\":\"42\"},{\"created_at\":\"2025-03-01T00:29:00Z\",\"entry_id\":29,\"fiel"
+        "d1\":\"20.65\",\"field2\":\"30\"},{\"created_at\":\"2025-03-01T00:30:00Z\",\"entry_id\":30,\"field1\":\"19.56\",\"fiel"
+        "d2\":\"67\"},{\"created_at\":\"2025-03-01T00:31:00Z\",\"entry_id\":31,\"field1\":\"22.33\",\"field2\":\"45\"},{\"creat"
+        "ed_at\":\"2025-03-01T00:32:00Z\",\"entry_id\":32,\"field1\":\"22.72\",\"field2\":\"41\"},{\"created_at\":\"2025-03-0"
+        "1T00:33:00Z\",\"entry_id\":33,\"field1\":\"18.11\",\"field2\":\"35\"},{\"created_at\":\"2025-03-01T00:34:00Z\",\"ent"
+        "ry_id\":34,\"field1\":\"18.57\",\"field2\":\"41\"},{\"created_at\":\"2025-03-01T00:35:00Z\",\"entry_id\":35,\"field1"
+        "\":\"18.15\",\"field2\":\"61\"},{\"created_at\":\"2025-03-01T00:36:00Z\",\"entry_id\":36,\"field1\":\"21.69\",\"field2"
+        "\":\"30\"},{\"created_at\":\"2025-03-01T00:37:00Z\",\"entry_id\":37,\"field1\":\"22.03\",\"field2\":\"62\"},{\"created"
+        "_at\":\"2025-03-01T00:38:00Z\",\"entry_id\":38,\"field1\":\"22.97\",\"field2\":\"40\"},{\"created_at\":\"2025-03-01T"
+        "00:39:00Z\",\"entry_id\":39,\"field1\":\"22.99\",\"field2\":\"64\"},{\"created_at\":\"2025-03-01T00:40:00Z\",\"entry"
+        "_id\":40,\"field1\":\"19.75\",\"field2\":\"58\"}]}";
+
+    // The feed in stored blocks, compression level 0
+    static const uint8_t inflateStored[] = {
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x01, 0xd5, 0x0d, 0x2a, 0xf2, 0x7b,
+        0x22, 0x63, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x22, 0x3a, 0x7b, 0x22, 0x69, 0x64, 0x22, 0x3a,
+        0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x2c, 0x22, 0x6e, 0x61, 0x6d, 0x65, 0x22, 0x3a, 0x22,
+        0x57, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22,
+        0x2c, 0x22, 0x6c, 0x61, 0x74, 0x69, 0x74, 0x75, 0x64, 0x65, 0x22, 0x3a, 0x22, 0x30, 0x2e, 0x30,
+        0x22, 0x2c, 0x22, 0x6c, 0x6f, 0x6e, 0x67, 0x69, 0x74, 0x75, 0x64, 0x65, 0x22, 0x3a, 0x22, 0x30,
+        0x2e, 0x30, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x54, 0x65,
+        0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c,
+        0x64, 0x32, 0x22, 0x3a, 0x22, 0x48, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x22, 0x2c, 0x22,
+        0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32,
+        0x35, 0x2d, 0x30, 0x31, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x30, 0x30, 0x3a, 0x30, 0x30,
+        0x5a, 0x22, 0x2c, 0x22, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a,
+        0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x31, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x30,
+        0x30, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x65, 0x6e, 0x74,
+        0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x34, 0x30, 0x7d, 0x2c, 0x22, 0x66, 0x65, 0x65, 0x64,
+        0x73, 0x22, 0x3a, 0x5b, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74,
+        0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30,
+        0x3a, 0x30, 0x31, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f,
+        0x69, 0x64, 0x22, 0x3a, 0x31, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22,
+        0x32, 0x31, 0x2e, 0x32, 0x39, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a,
+        0x22, 0x33, 0x38, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f,
+        0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54,
+        0x30, 0x30, 0x3a, 0x30, 0x32, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72,
+        0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x32, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22,
+        0x3a, 0x22, 0x32, 0x32, 0x2e, 0x34, 0x38, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32,
+        0x22, 0x3a, 0x22, 0x33, 0x39, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+        0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30,
+        0x31, 0x54, 0x30, 0x30, 0x3a, 0x30, 0x33, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e,
+        0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x33, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64,
+        0x31, 0x22, 0x3a, 0x22, 0x31, 0x39, 0x2e, 0x37, 0x32, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c,
+        0x64, 0x32, 0x22, 0x3a, 0x22, 0x34, 0x36, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61,
+        0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33,
+        0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x30, 0x34, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22,
+        0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x34, 0x2c, 0x22, 0x66, 0x69, 0x65,
+        0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x31, 0x2e, 0x34, 0x30, 0x22, 0x2c, 0x22, 0x66, 0x69,
+        0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x36, 0x33, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72,
+        0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d,
+        0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x30, 0x35, 0x3a, 0x30, 0x30, 0x5a, 0x22,
+        0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x35, 0x2c, 0x22, 0x66,
+        0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x32, 0x2e, 0x35, 0x33, 0x22, 0x2c, 0x22,
+        0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x34, 0x37, 0x22, 0x7d, 0x2c, 0x7b, 0x22,
+        0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32,
+        0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x30, 0x36, 0x3a, 0x30, 0x30,
+        0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x36, 0x2c,
+        0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x31, 0x2e, 0x39, 0x32, 0x22,
+        0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x36, 0x37, 0x22, 0x7d, 0x2c,
+        0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32,
+        0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x30, 0x37, 0x3a,
+        0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a,
+        0x37, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x33, 0x2e, 0x35,
+        0x38, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x33, 0x36, 0x22,
+        0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a,
+        0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x30,
+        0x38, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64,
+        0x22, 0x3a, 0x38, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x30,
+        0x2e, 0x31, 0x39, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x36,
+        0x32, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74,
+        0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30,
+        0x3a, 0x30, 0x39, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f,
+        0x69, 0x64, 0x22, 0x3a, 0x39, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22,
+        0x31, 0x38, 0x2e, 0x30, 0x37, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a,
+        0x22, 0x36, 0x31, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f,
+        0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54,
+        0x30, 0x30, 0x3a, 0x31, 0x30, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72,
+        0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x31, 0x30, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31,
+        0x22, 0x3a, 0x22, 0x32, 0x30, 0x2e, 0x32, 0x35, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64,
+        0x32, 0x22, 0x3a, 0x22, 0x33, 0x31, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74,
+        0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d,
+        0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x31, 0x31, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65,
+        0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x31, 0x31, 0x2c, 0x22, 0x66, 0x69, 0x65,
+        0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x2e, 0x30, 0x35, 0x22, 0x2c, 0x22, 0x66, 0x69,
+        0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x36, 0x31, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72,
+        0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d,
+        0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x31, 0x32, 0x3a, 0x30, 0x30, 0x5a, 0x22,
+        0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x31, 0x32, 0x2c, 0x22,
+        0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x31, 0x38, 0x2e, 0x33, 0x31, 0x22, 0x2c,
+        0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x34, 0x35, 0x22, 0x7d, 0x2c, 0x7b,
+        0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30,
+        0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x31, 0x33, 0x3a, 0x30,
+        0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x31,
+        0x33, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x33, 0x2e, 0x38,
+        0x38, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x33, 0x35, 0x22,
+        0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a,
+        0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x31,
+        0x34, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64,
+        0x22, 0x3a, 0x31, 0x34, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x31,
+        0x38, 0x2e, 0x39, 0x34, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22,
+        0x34, 0x30, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61,
+        0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30,
+        0x30, 0x3a, 0x31, 0x35, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79,
+        0x5f, 0x69, 0x64, 0x22, 0x3a, 0x31, 0x35, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22,
+        0x3a, 0x22, 0x32, 0x31, 0x2e, 0x33, 0x39, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32,
+        0x22, 0x3a, 0x22, 0x36, 0x30, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+        0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30,
+        0x31, 0x54, 0x30, 0x30, 0x3a, 0x31, 0x36, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e,
+        0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x31, 0x36, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c,
+        0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x33, 0x2e, 0x30, 0x38, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65,
+        0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x33, 0x35, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65,
+        0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30,
+        0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x31, 0x37, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c,
+        0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x31, 0x37, 0x2c, 0x22, 0x66,
+        0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x31, 0x39, 0x2e, 0x37, 0x36, 0x22, 0x2c, 0x22,
+        0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x36, 0x36, 0x22, 0x7d, 0x2c, 0x7b, 0x22,
+        0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32,
+        0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x31, 0x38, 0x3a, 0x30, 0x30,
+        0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x31, 0x38,
+        0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x31, 0x38, 0x2e, 0x34, 0x36,
+        0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x33, 0x38, 0x22, 0x7d,
+        0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22,
+        0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x31, 0x39,
+        0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22,
+        0x3a, 0x31, 0x39, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x31,
+        0x2e, 0x32, 0x38, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x35,
+        0x38, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74,
+        0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30,
+        0x3a, 0x32, 0x30, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f,
+        0x69, 0x64, 0x22, 0x3a, 0x32, 0x30, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a,
+        0x22, 0x32, 0x33, 0x2e, 0x38, 0x33, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22,
+        0x3a, 0x22, 0x36, 0x31, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+        0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31,
+        0x54, 0x30, 0x30, 0x3a, 0x32, 0x31, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74,
+        0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x32, 0x31, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64,
+        0x31, 0x22, 0x3a, 0x22, 0x31, 0x39, 0x2e, 0x39, 0x34, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c,
+        0x64, 0x32, 0x22, 0x3a, 0x22, 0x36, 0x39, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61,
+        0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33,
+        0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x32, 0x32, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22,
+        0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x32, 0x32, 0x2c, 0x22, 0x66, 0x69,
+        0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x2e, 0x33, 0x33, 0x22, 0x2c, 0x22, 0x66,
+        0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x34, 0x36, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63,
+        0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35,
+        0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x32, 0x33, 0x3a, 0x30, 0x30, 0x5a,
+        0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x32, 0x33, 0x2c,
+        0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x32, 0x2e, 0x36, 0x36, 0x22,
+        0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x35, 0x39, 0x22, 0x7d, 0x2c,
+        0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32,
+        0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x32, 0x34, 0x3a,
+        0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a,
+        0x32, 0x34, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x31, 0x2e,
+        0x30, 0x32, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x33, 0x32,
+        0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22,
+        0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a,
+        0x32, 0x35, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69,
+        0x64, 0x22, 0x3a, 0x32, 0x35, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22,
+        0x32, 0x33, 0x2e, 0x33, 0x33, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a,
+        0x22, 0x33, 0x37, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f,
+        0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54,
+        0x30, 0x30, 0x3a, 0x32, 0x36, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72,
+        0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x32, 0x36, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31,
+        0x22, 0x3a, 0x22, 0x32, 0x32, 0x2e, 0x30, 0x32, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64,
+        0x32, 0x22, 0x3a, 0x22, 0x36, 0x35, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74,
+        0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d,
+        0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x32, 0x37, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65,
+        0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x32, 0x37, 0x2c, 0x22, 0x66, 0x69, 0x65,
+        0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x2e, 0x38, 0x35, 0x22, 0x2c, 0x22, 0x66, 0x69,
+        0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x33, 0x34, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72,
+        0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d,
+        0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x32, 0x38, 0x3a, 0x30, 0x30, 0x5a, 0x22,
+        0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x32, 0x38, 0x2c, 0x22,
+        0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x2e, 0x32, 0x36, 0x22, 0x2c,
+        0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x34, 0x32, 0x22, 0x7d, 0x2c, 0x7b,
+        0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30,
+        0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x32, 0x39, 0x3a, 0x30,
+        0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x32,
+        0x39, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x2e, 0x36,
+        0x35, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x33, 0x30, 0x22,
+        0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a,
+        0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x33,
+        0x30, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64,
+        0x22, 0x3a, 0x33, 0x30, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x31,
+        0x39, 0x2e, 0x35, 0x36, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22,
+        0x36, 0x37, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61,
+        0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30,
+        0x30, 0x3a, 0x33, 0x31, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79,
+        0x5f, 0x69, 0x64, 0x22, 0x3a, 0x33, 0x31, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22,
+        0x3a, 0x22, 0x32, 0x32, 0x2e, 0x33, 0x33, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32,
+        0x22, 0x3a, 0x22, 0x34, 0x35, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+        0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30,
+        0x31, 0x54, 0x30, 0x30, 0x3a, 0x33, 0x32, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e,
+        0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x33, 0x32, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c,
+        0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x32, 0x2e, 0x37, 0x32, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65,
+        0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x34, 0x31, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65,
+        0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30,
+        0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x33, 0x33, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c,
+        0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x33, 0x33, 0x2c, 0x22, 0x66,
+        0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x31, 0x38, 0x2e, 0x31, 0x31, 0x22, 0x2c, 0x22,
+        0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x33, 0x35, 0x22, 0x7d, 0x2c, 0x7b, 0x22,
+        0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32,
+        0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x33, 0x34, 0x3a, 0x30, 0x30,
+        0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x33, 0x34,
+        0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x31, 0x38, 0x2e, 0x35, 0x37,
+        0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x34, 0x31, 0x22, 0x7d,
+        0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22,
+        0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x33, 0x35,
+        0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22,
+        0x3a, 0x33, 0x35, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x31, 0x38,
+        0x2e, 0x31, 0x35, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x36,
+        0x31, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74,
+        0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30,
+        0x3a, 0x33, 0x36, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f,
+        0x69, 0x64, 0x22, 0x3a, 0x33, 0x36, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a,
+        0x22, 0x32, 0x31, 0x2e, 0x36, 0x39, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22,
+        0x3a, 0x22, 0x33, 0x30, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64,
+        0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31,
+        0x54, 0x30, 0x30, 0x3a, 0x33, 0x37, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74,
+        0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x33, 0x37, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64,
+        0x31, 0x22, 0x3a, 0x22, 0x32, 0x32, 0x2e, 0x30, 0x33, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c,
+        0x64, 0x32, 0x22, 0x3a, 0x22, 0x36, 0x32, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63, 0x72, 0x65, 0x61,
+        0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35, 0x2d, 0x30, 0x33,
+        0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x33, 0x38, 0x3a, 0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22,
+        0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x33, 0x38, 0x2c, 0x22, 0x66, 0x69,
+        0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x32, 0x2e, 0x39, 0x37, 0x22, 0x2c, 0x22, 0x66,
+        0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x34, 0x30, 0x22, 0x7d, 0x2c, 0x7b, 0x22, 0x63,
+        0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32, 0x30, 0x32, 0x35,
+        0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x33, 0x39, 0x3a, 0x30, 0x30, 0x5a,
+        0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a, 0x33, 0x39, 0x2c,
+        0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x32, 0x32, 0x2e, 0x39, 0x39, 0x22,
+        0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x36, 0x34, 0x22, 0x7d, 0x2c,
+        0x7b, 0x22, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x22, 0x3a, 0x22, 0x32,
+        0x30, 0x32, 0x35, 0x2d, 0x30, 0x33, 0x2d, 0x30, 0x31, 0x54, 0x30, 0x30, 0x3a, 0x34, 0x30, 0x3a,
+        0x30, 0x30, 0x5a, 0x22, 0x2c, 0x22, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x5f, 0x69, 0x64, 0x22, 0x3a,
+        0x34, 0x30, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x31, 0x22, 0x3a, 0x22, 0x31, 0x39, 0x2e,
+        0x37, 0x35, 0x22, 0x2c, 0x22, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x32, 0x22, 0x3a, 0x22, 0x35, 0x38,
+        0x22, 0x7d, 0x5d, 0x7d, 0x74, 0x07, 0x72, 0x8a, 0xd5, 0x0d, 0x00, 0x00,
+    };
+
+    // The feed in fixed Huffman blocks
+    static const uint8_t inflateFixed[] = {
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xab, 0x56, 0x4a, 0xce, 0x48, 0xcc,
+        0xcb, 0x4b, 0xcd, 0x51, 0xb2, 0xaa, 0x56, 0xca, 0x4c, 0x51, 0xb2, 0x32, 0x34, 0x32, 0x36, 0x31,
+        0x35, 0x33, 0xd7, 0x51, 0xca, 0x4b, 0xcc, 0x4d, 0x55, 0xb2, 0x52, 0x0a, 0x4f, 0x4d, 0x2c, 0xc9,
+        0x48, 0x2d, 0x52, 0x28, 0x2e, 0x49, 0x2c, 0xc9, 0xcc, 0xcf, 0x53, 0xd2, 0x51, 0xca, 0x01, 0x32,
+        0x4a, 0x4a, 0x53, 0x40, 0x92, 0x06, 0x7a, 0x06, 0x20, 0x81, 0xfc, 0xbc, 0x74, 0x54, 0x91, 0xb4,
+        0xcc, 0xd4, 0x9c, 0x14, 0x43, 0x20, 0x37, 0x24, 0x35, 0xb7, 0x20, 0xb5, 0x28, 0xb1, 0xa4, 0xb4,
+        0x28, 0x15, 0x26, 0x6c, 0x04, 0x14, 0xf6, 0x28, 0xcd, 0xcd, 0x4c, 0xc9, 0x2c, 0xa9, 0x04, 0x8a,
+        0x25, 0x17, 0x01, 0x2d, 0x48, 0x4d, 0x89, 0x4f, 0x2c, 0x01, 0x8a, 0x1b, 0x19, 0x18, 0x99, 0xea,
+        0x1a, 0x18, 0x02, 0x51, 0x88, 0x81, 0x81, 0x15, 0x18, 0x45, 0x01, 0xd5, 0x94, 0x16, 0xa4, 0x10,
+        0x54, 0x93, 0x93, 0x58, 0x5c, 0x12, 0x9f, 0x9a, 0x57, 0x52, 0x54, 0x19, 0x0f, 0xf2, 0x86, 0x89,
+        0x41, 0x2d, 0xd0, 0xbe, 0xd4, 0xd4, 0x94, 0x62, 0x25, 0xab, 0xe8, 0x6a, 0x6c, 0xb6, 0x18, 0xc3,
+        0x4c, 0x30, 0x84, 0x9a, 0x80, 0xd0, 0x6c, 0x88, 0xe4, 0x03, 0x23, 0x43, 0x3d, 0x23, 0x4b, 0x64,
+        0xb7, 0x1b, 0x5b, 0x28, 0xd5, 0xea, 0xe0, 0x37, 0xd1, 0x08, 0xc3, 0x44, 0x23, 0x64, 0x13, 0x8d,
+        0xf4, 0x4c, 0x2c, 0x50, 0x4c, 0xb4, 0x24, 0x68, 0xa2, 0x31, 0x86, 0x89, 0xc6, 0x48, 0x26, 0x1a,
+        0x5a, 0xea, 0x99, 0x1b, 0x21, 0x9b, 0x68, 0x62, 0x46, 0xd0, 0x44, 0x13, 0x0c, 0x13, 0x4d, 0x50,
+        0x7d, 0x6d, 0x62, 0x80, 0x6c, 0xa2, 0x99, 0x31, 0x41, 0x13, 0x4d, 0x31, 0x4c, 0x34, 0x45, 0xf5,
+        0xb5, 0xa9, 0x31, 0x8a, 0x1b, 0xcd, 0x09, 0x9a, 0x68, 0x86, 0x61, 0xa2, 0x19, 0xaa, 0x1b, 0x2d,
+        0x51, 0x7c, 0x6d, 0x46, 0xd8, 0x44, 0x73, 0x0c, 0x13, 0xcd, 0x91, 0x4d, 0x34, 0xd6, 0x33, 0x45,
+        0x8d, 0x19, 0xc2, 0xe1, 0x68, 0x81, 0x61, 0xa2, 0x05, 0xb2, 0x89, 0x06, 0x7a, 0x86, 0x28, 0xa9,
+        0xc7, 0xcc, 0x88, 0xa0, 0x89, 0x96, 0x18, 0x26, 0x5a, 0x22, 0xc7, 0xb5, 0x85, 0x9e, 0x81, 0x39,
+        0x8a, 0x89, 0x86, 0x84, 0x4c, 0x34, 0x34, 0xc0, 0x4c, 0xe1, 0x06, 0xa8, 0x8e, 0x34, 0x32, 0x45,
+        0xf1, 0x36, 0x61, 0x23, 0xb1, 0x64, 0x1a, 0x43, 0x54, 0x23, 0x0d, 0x4c, 0x49, 0x74, 0x25, 0x66,
+        0xae, 0x31, 0x34, 0x42, 0xf5, 0x38, 0xd0, 0x5d, 0xc8, 0x09, 0xc8, 0x94, 0xa0, 0x91, 0x98, 0xd9,
+        0xc6, 0xd0, 0x18, 0x35, 0xbe, 0x2d, 0x50, 0xe3, 0x9b, 0xb0, 0x91, 0x98, 0xf9, 0xc6, 0xd0, 0x04,
+        0xd5, 0x95, 0x96, 0x26, 0x28, 0xae, 0x34, 0x20, 0x68, 0x24, 0x66, 0xc6, 0x31, 0x34, 0x45, 0x4d,
+        0xe7, 0xc6, 0xa8, 0x69, 0x88, 0xb0, 0x91, 0x98, 0x39, 0xc7, 0xd0, 0x0c, 0xd5, 0xe3, 0x06, 0xa4,
+        0x7a, 0x1c, 0x33, 0xeb, 0x18, 0x9a, 0xa3, 0x95, 0x41, 0x66, 0x28, 0xae, 0x24, 0x98, 0x77, 0x0c,
+        0x31, 0xf3, 0x8e, 0xa1, 0x05, 0x6a, 0x58, 0x9a, 0x98, 0x91, 0x56, 0xf4, 0x1a, 0x62, 0x66, 0x1e,
+        0x43, 0x4b, 0xb4, 0xd2, 0x1c, 0xc5, 0xe3, 0xa6, 0x04, 0x8d, 0x34, 0xc2, 0xcc, 0x3d, 0x46, 0x06,
+        0x68, 0x89, 0xc8, 0x98, 0xb4, 0xa4, 0x6e, 0x84, 0x99, 0x7b, 0x8c, 0x0c, 0x51, 0xc3, 0x12, 0x35,
+        0x11, 0x99, 0x11, 0xac, 0x21, 0x8c, 0xb0, 0xd4, 0x39, 0x46, 0xa8, 0x19, 0xd2, 0xd8, 0x98, 0xb4,
+        0x2a, 0xc2, 0x08, 0x33, 0xf7, 0x18, 0x19, 0xa3, 0x96, 0xe8, 0x66, 0x28, 0xd1, 0x63, 0x4a, 0xd8,
+        0x95, 0x98, 0xb9, 0xc7, 0x08, 0xad, 0xda, 0x31, 0x40, 0x29, 0xd2, 0x8d, 0x09, 0x16, 0x97, 0x46,
+        0x98, 0xb9, 0xc7, 0xc8, 0x14, 0x35, 0x7a, 0x50, 0x3d, 0x6e, 0x4c, 0xb0, 0x96, 0x30, 0xc2, 0xcc,
+        0x3d, 0x46, 0x66, 0xa8, 0x1e, 0x47, 0x75, 0xa5, 0x19, 0xc1, 0xdc, 0x63, 0x84, 0x99, 0x7b, 0x8c,
+        0xcc, 0x51, 0xa3, 0xc7, 0x02, 0xb5, 0x08, 0x36, 0x21, 0x68, 0x24, 0x66, 0xee, 0x31, 0x42, 0xab,
+        0x7a, 0x8c, 0x50, 0xa2, 0xc7, 0x84, 0x70, 0x58, 0x62, 0xe6, 0x1e, 0x23, 0x4b, 0x54, 0x23, 0xcd,
+        0x50, 0x5d, 0x49, 0xb0, 0x24, 0x32, 0xc6, 0xcc, 0x3d, 0xc6, 0x06, 0xa8, 0x49, 0xdd, 0xd4, 0x8c,
+        0xb4, 0x4a, 0xdc, 0x18, 0x33, 0xf7, 0x18, 0x1b, 0xa2, 0x46, 0x0f, 0x5a, 0x52, 0x27, 0x18, 0x3d,
+        0xc6, 0x98, 0xb9, 0xc7, 0x18, 0xad, 0xc9, 0x86, 0xd6, 0xc0, 0x22, 0x98, 0xc7, 0x8d, 0xb1, 0x34,
+        0xd9, 0x8c, 0x51, 0x0b, 0x37, 0x43, 0x43, 0xd2, 0x8a, 0x60, 0x63, 0xcc, 0xdc, 0x63, 0x8c, 0x56,
+        0xf7, 0x98, 0x9a, 0x93, 0xe8, 0x4a, 0xcc, 0xdc, 0x63, 0x6c, 0x8a, 0xe6, 0x4a, 0x12, 0xeb, 0x71,
+        0x63, 0xcc, 0xdc, 0x63, 0x8c, 0xd6, 0x6c, 0x33, 0xb3, 0x24, 0x31, 0x11, 0x61, 0xe6, 0x1e, 0x63,
+        0x73, 0xb4, 0x0c, 0x69, 0x4c, 0x5a, 0x2b, 0xcb, 0x18, 0x33, 0xf7, 0x18, 0x5b, 0xa0, 0x1a, 0x69,
+        0x69, 0x4e, 0x5a, 0x3d, 0x6e, 0x8c, 0x99, 0x7b, 0x8c, 0x2d, 0xd1, 0x8c, 0x44, 0xad, 0xc7, 0x09,
+        0xe6, 0x71, 0x13, 0xcc, 0xdc, 0x63, 0x82, 0x96, 0x7b, 0xcc, 0x4d, 0xd1, 0xab, 0xb3, 0xd8, 0x5a,
+        0x00, 0x74, 0x07, 0x72, 0x8a, 0xd5, 0x0d, 0x00, 0x00,
+    };
+
+    // The feed in dynamic Huffman blocks
+    static const uint8_t inflateDynamic[] = {
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x96, 0xdd, 0x6a, 0xdb, 0x40,
+        0x10, 0x46, 0x5f, 0xa5, 0xe8, 0xda, 0x15, 0x3b, 0x33, 0xfb, 0xa3, 0xf5, 0x13, 0xf4, 0x01, 0x02,
+        0x85, 0x96, 0x62, 0x44, 0xa4, 0x36, 0x06, 0x5b, 0x09, 0xb6, 0x7c, 0x11, 0x8c, 0xdf, 0xbd, 0x72,
+        0x69, 0xa8, 0xbe, 0x1d, 0xd3, 0x61, 0xc1, 0x17, 0xc9, 0xc6, 0x39, 0x9a, 0xd1, 0xcc, 0x99, 0xd9,
+        0x6b, 0xf3, 0xfc, 0xd2, 0x4f, 0xd3, 0x78, 0x68, 0xb6, 0xd7, 0x66, 0x3f, 0x34, 0x5b, 0x62, 0xf1,
+        0x21, 0xa6, 0x4d, 0x33, 0xf5, 0xc7, 0xb1, 0xd9, 0x36, 0x5f, 0xc7, 0x7e, 0x7e, 0x19, 0x4f, 0x9f,
+        0xce, 0x73, 0x3f, 0xef, 0x5f, 0xa7, 0x66, 0xd3, 0x1c, 0x96, 0x1f, 0xe6, 0xcb, 0x70, 0xff, 0xa3,
+        0x6b, 0xdd, 0xfd, 0xe0, 0x75, 0xfa, 0x85, 0x27, 0x3f, 0xf7, 0xe3, 0x61, 0xa0, 0xe5, 0xd7, 0xa7,
+        0xf1, 0xf8, 0x36, 0x9e, 0xfa, 0xf9, 0x72, 0x1a, 0x3f, 0x8e, 0x79, 0x39, 0xfe, 0x72, 0x39, 0xee,
+        0x87, 0xfd, 0xfc, 0xbe, 0x9c, 0x3d, 0x9f, 0x96, 0x07, 0x8c, 0xc3, 0xae, 0x9f, 0x97, 0x73, 0x76,
+        0x1c, 0x3e, 0x3b, 0x5a, 0x3e, 0x4f, 0xce, 0x6d, 0xff, 0x7c, 0xbe, 0x2d, 0xdf, 0xb9, 0xbc, 0x0d,
+        0xe6, 0x77, 0x0e, 0xfd, 0x79, 0xde, 0x8d, 0xd3, 0x7c, 0x7a, 0xdf, 0xdd, 0xd3, 0xf0, 0xee, 0xb6,
+        0x3c, 0x6f, 0x1c, 0x87, 0x73, 0xb3, 0xfd, 0x7e, 0x7d, 0xf4, 0x14, 0xf9, 0x20, 0xd0, 0x5f, 0xc2,
+        0xbf, 0x7f, 0xa6, 0x55, 0x06, 0x4c, 0x2d, 0xe7, 0x75, 0xec, 0xd2, 0x35, 0xb7, 0xcd, 0xff, 0x89,
+        0xac, 0x88, 0xbc, 0x26, 0x72, 0xeb, 0x3b, 0x20, 0x66, 0x93, 0x28, 0x8a, 0x28, 0x2b, 0x22, 0xe5,
+        0x36, 0xf1, 0x9a, 0xe8, 0xa3, 0x49, 0xf4, 0x8a, 0xe8, 0x31, 0x6b, 0xef, 0xd6, 0xc4, 0x28, 0x26,
+        0x31, 0x28, 0x62, 0xc0, 0xac, 0x83, 0x40, 0x8c, 0xc9, 0x24, 0x46, 0x45, 0x8c, 0x18, 0x63, 0x86,
+        0xac, 0xa3, 0x4d, 0x4c, 0x8a, 0x98, 0xd6, 0x44, 0x69, 0x03, 0x56, 0xc6, 0x7e, 0x8f, 0x9d, 0x22,
+        0x76, 0x6b, 0xa2, 0x6b, 0x09, 0xba, 0x27, 0xb2, 0x49, 0xcc, 0x8a, 0x98, 0xd7, 0xb5, 0xee, 0x5a,
+        0x97, 0x80, 0x48, 0x16, 0x91, 0x9c, 0xee, 0x70, 0x87, 0x41, 0x72, 0x80, 0xb4, 0x6d, 0xe4, 0x03,
+        0x69, 0x08, 0x91, 0x2e, 0x54, 0x46, 0xa9, 0xad, 0x21, 0xc6, 0xc4, 0x97, 0xb8, 0xd6, 0x0d, 0x14,
+        0x4c, 0xa4, 0xd6, 0x86, 0x04, 0xeb, 0xdd, 0x61, 0xbd, 0x6d, 0xa4, 0xf6, 0x86, 0x3c, 0x46, 0x99,
+        0x3d, 0x44, 0xe9, 0x4c, 0xa4, 0x16, 0x87, 0x02, 0xf6, 0xb9, 0x60, 0x0f, 0xd9, 0x48, 0x6d, 0x0e,
+        0x45, 0x4c, 0xdc, 0xd5, 0x26, 0xae, 0xd5, 0xa1, 0x54, 0xcc, 0xa0, 0x08, 0x51, 0x9a, 0xee, 0x90,
+        0x76, 0x87, 0x3a, 0x7c, 0x97, 0x3e, 0xd6, 0x8d, 0x5e, 0xd2, 0xf2, 0x50, 0x2e, 0xa6, 0x39, 0x24,
+        0x1e, 0x4c, 0x24, 0x6b, 0x7b, 0xd8, 0x15, 0x4d, 0x24, 0x75, 0xad, 0xce, 0xda, 0x1e, 0x26, 0x7c,
+        0x97, 0xd8, 0x44, 0xd1, 0xdc, 0x10, 0xfc, 0x60, 0xe7, 0x30, 0x0a, 0x29, 0x52, 0xb7, 0x22, 0x58,
+        0xdb, 0xc3, 0x82, 0x13, 0x3d, 0x42, 0x79, 0x82, 0x1d, 0xa5, 0xb6, 0x87, 0x8b, 0xb5, 0xe3, 0x60,
+        0xa4, 0x8b, 0x39, 0x2e, 0x59, 0xdb, 0xc3, 0x01, 0xcb, 0x83, 0x89, 0x8b, 0xb9, 0x25, 0x58, 0xdb,
+        0xc3, 0x11, 0x13, 0xc7, 0x28, 0xa3, 0x69, 0x0f, 0x6b, 0x7b, 0x38, 0x61, 0x79, 0x3a, 0x1c, 0xc1,
+        0xde, 0x44, 0x6a, 0x7b, 0xb8, 0x58, 0x3d, 0x0c, 0xe5, 0xf1, 0xf6, 0xbb, 0xd4, 0xf6, 0x70, 0x46,
+        0x64, 0xc4, 0x28, 0xcd, 0x49, 0x24, 0xda, 0x1e, 0x71, 0xd8, 0xea, 0x21, 0xd6, 0x2d, 0x71, 0xd1,
+        0xf6, 0x08, 0x61, 0x79, 0x8a, 0x56, 0x37, 0xcb, 0x23, 0xda, 0x1e, 0x29, 0xae, 0x6c, 0xc5, 0x05,
+        0xcb, 0x74, 0x5c, 0x1e, 0x5c, 0xd9, 0x04, 0x87, 0x1b, 0x51, 0xdd, 0x08, 0x16, 0x6d, 0x8f, 0x14,
+        0xbb, 0x27, 0xa4, 0xca, 0x28, 0xb5, 0x3d, 0x12, 0x8a, 0x28, 0x2b, 0xf7, 0xb8, 0x68, 0x7b, 0xa4,
+        0xb8, 0xb6, 0xc5, 0x5c, 0xd9, 0x44, 0xda, 0x1e, 0x49, 0x85, 0x90, 0x52, 0x77, 0xcb, 0x12, 0x6d,
+        0x8f, 0x74, 0x88, 0xcc, 0xa9, 0x6e, 0x8f, 0x8b, 0xb6, 0x47, 0x72, 0x81, 0xc4, 0x3d, 0x6e, 0x3a,
+        0xee, 0xb5, 0x3d, 0xbe, 0xb0, 0x27, 0x85, 0x72, 0x9d, 0xfd, 0xb8, 0xfd, 0x06, 0x74, 0x07, 0x72,
+        0x8a, 0xd5, 0x0d, 0x00, 0x00,
+    };
+
+    // inflateDynamic with one bit of the CRC-32 in the trailer flipped
+    static const uint8_t inflateCorruptCRC[] = {
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x96, 0xdd, 0x6a, 0xdb, 0x40,
+        0x10, 0x46, 0x5f, 0xa5, 0xe8, 0xda, 0x15, 0x3b, 0x33, 0xfb, 0xa3, 0xf5, 0x13, 0xf4, 0x01, 0x02,
+        0x85, 0x96, 0x62, 0x44, 0xa4, 0x36, 0x06, 0x5b, 0x09, 0xb6, 0x7c, 0x11, 0x8c, 0xdf, 0xbd, 0x72,
+        0x69, 0xa8, 0xbe, 0x1d, 0xd3, 0x61, 0xc1, 0x17, 0xc9, 0xc6, 0x39, 0x9a, 0xd1, 0xcc, 0x99, 0xd9,
+        0x6b, 0xf3, 0xfc, 0xd2, 0x4f, 0xd3, 0x78, 0x68, 0xb6, 0xd7, 0x66, 0x3f, 0x34, 0x5b, 0x62, 0xf1,
+        0x21, 0xa6, 0x4d, 0x33, 0xf5, 0xc7, 0xb1, 0xd9, 0x36, 0x5f, 0xc7, 0x7e, 0x7e, 0x19, 0x4f, 0x9f,
+        0xce, 0x73, 0x3f, 0xef, 0x5f, 0xa7, 0x66, 0xd3, 0x1c, 0x96, 0x1f, 0xe6, 0xcb, 0x70, 0xff, 0xa3,
+        0x6b, 0xdd, 0xfd, 0xe0, 0x75, 0xfa, 0x85, 0x27, 0x3f, 0xf7, 0xe3, 0x61, 0xa0, 0xe5, 0xd7, 0xa7,
+        0xf1, 0xf8, 0x36, 0x9e, 0xfa, 0xf9, 0x72, 0x1a, 0x3f, 0x8e, 0x79, 0x39, 0xfe, 0x72, 0x39, 0xee,
+        0x87, 0xfd, 0xfc, 0xbe, 0x9c, 0x3d, 0x9f, 0x96, 0x07, 0x8c, 0xc3, 0xae, 0x9f, 0x97, 0x73, 0x76,
+        0x1c, 0x3e, 0x3b, 0x5a, 0x3e, 0x4f, 0xce, 0x6d, 0xff, 0x7c, 0xbe, 0x2d, 0xdf, 0xb9, 0xbc, 0x0d,
+        0xe6, 0x77, 0x0e, 0xfd, 0x79, 0xde, 0x8d, 0xd3, 0x7c, 0x7a, 0xdf, 0xdd, 0xd3, 0xf0, 0xee, 0xb6,
+        0x3c, 0x6f, 0x1c, 0x87, 0x73, 0xb3, 0xfd, 0x7e, 0x7d, 0xf4, 0x14, 0xf9, 0x20, 0xd0, 0x5f, 0xc2,
+        0xbf, 0x7f, 0xa6, 0x55, 0x06, 0x4c, 0x2d, 0xe7, 0x75, 0xec, 0xd2, 0x35, 0xb7, 0xcd, 0xff, 0x89,
+        0xac, 0x88, 0xbc, 0x26, 0x72, 0xeb, 0x3b, 0x20, 0x66, 0x93, 0x28, 0x8a, 0x28, 0x2b, 0x22, 0xe5,
+        0x36, 0xf1, 0x9a, 0xe8, 0xa3, 0x49, 0xf4, 0x8a, 0xe8, 0x31, 0x6b, 0xef, 0xd6, 0xc4, 0x28, 0x26,
+        0x31, 0x28, 0x62, 0xc0, 0xac, 0x83, 0x40, 0x8c, 0xc9, 0x24, 0x46, 0x45, 0x8c, 0x18, 0x63, 0x86,
+        0xac, 0xa3, 0x4d, 0x4c, 0x8a, 0x98, 0xd6, 0x44, 0x69, 0x03, 0x56, 0xc6, 0x7e, 0x8f, 0x9d, 0x22,
+        0x76, 0x6b, 0xa2, 0x6b, 0x09, 0xba, 0x27, 0xb2, 0x49, 0xcc, 0x8a, 0x98, 0xd7, 0xb5, 0xee, 0x5a,
+        0x97, 0x80, 0x48, 0x16, 0x91, 0x9c, 0xee, 0x70, 0x87, 0x41, 0x72, 0x80, 0xb4, 0x6d, 0xe4, 0x03,
+        0x69, 0x08, 0x91, 0x2e, 0x54, 0x46, 0xa9, 0xad, 0x21, 0xc6, 0xc4, 0x97, 0xb8, 0xd6, 0x0d, 0x14,
+        0x4c, 0xa4, 0xd6, 0x86, 0x04, 0xeb, 0xdd, 0x61, 0xbd, 0x6d, 0xa4, 0xf6, 0x86, 0x3c, 0x46, 0x99,
+        0x3d, 0x44, 0xe9, 0x4c, 0xa4, 0x16, 0x87, 0x02, 0xf6, 0xb9, 0x60, 0x0f, 0xd9, 0x48, 0x6d, 0x0e,
+        0x45, 0x4c, 0xdc, 0xd5, 0x26, 0xae, 0xd5, 0xa1, 0x54, 0xcc, 0xa0, 0x08, 0x51, 0x9a, 0xee, 0x90,
+        0x76, 0x87, 0x3a, 0x7c, 0x97, 0x3e, 0xd6, 0x8d, 0x5e, 0xd2, 0xf2, 0x50, 0x2e, 0xa6, 0x39, 0x24,
+        0x1e, 0x4c, 0x24, 0x6b, 0x7b, 0xd8, 0x15, 0x4d, 0x24, 0x75, 0xad, 0xce, 0xda, 0x1e, 0x26, 0x7c,
+        0x97, 0xd8, 0x44, 0xd1, 0xdc, 0x10, 0xfc, 0x60, 0xe7, 0x30, 0x0a, 0x29, 0x52, 0xb7, 0x22, 0x58,
+        0xdb, 0xc3, 0x82, 0x13, 0x3d, 0x42, 0x79, 0x82, 0x1d, 0xa5, 0xb6, 0x87, 0x8b, 0xb5, 0xe3, 0x60,
+        0xa4, 0x8b, 0x39, 0x2e, 0x59, 0xdb, 0xc3, 0x01, 0xcb, 0x83, 0x89, 0x8b, 0xb9, 0x25, 0x58, 0xdb,
+        0xc3, 0x11, 0x13, 0xc7, 0x28, 0xa3, 0x69, 0x0f, 0x6b, 0x7b, 0x38, 0x61, 0x79, 0x3a, 0x1c, 0xc1,
+        0xde, 0x44, 0x6a, 0x7b, 0xb8, 0x58, 0x3d, 0x0c, 0xe5, 0xf1, 0xf6, 0xbb, 0xd4, 0xf6, 0x70, 0x46,
+        0x64, 0xc4, 0x28, 0xcd, 0x49, 0x24, 0xda, 0x1e, 0x71, 0xd8, 0xea, 0x21, 0xd6, 0x2d, 0x71, 0xd1,
+        0xf6, 0x08, 0x61, 0x79, 0x8a, 0x56, 0x37, 0xcb, 0x23, 0xda, 0x1e, 0x29, 0xae, 0x6c, 0xc5, 0x05,
+        0xcb, 0x74, 0x5c, 0x1e, 0x5c, 0xd9, 0x04, 0x87, 0x1b, 0x51, 0xdd, 0x08, 0x16, 0x6d, 0x8f, 0x14,
+        0xbb, 0x27, 0xa4, 0xca, 0x28, 0xb5, 0x3d, 0x12, 0x8a, 0x28, 0x2b, 0xf7, 0xb8, 0x68, 0x7b, 0xa4,
+        0xb8, 0xb6, 0xc5, 0x5c, 0xd9, 0x44, 0xda, 0x1e, 0x49, 0x85, 0x90, 0x52, 0x77, 0xcb, 0x12, 0x6d,
+        0x8f, 0x74, 0x88, 0xcc, 0xa9, 0x6e, 0x8f, 0x8b, 0xb6, 0x47, 0x72, 0x81, 0xc4, 0x3d, 0x6e, 0x3a,
+        0xee, 0xb5, 0x3d, 0xbe, 0xb0, 0x27, 0x85, 0x72, 0x9d, 0xfd, 0xb8, 0xfd, 0x06, 0x75, 0x07, 0x72,
+        0x8a, 0xd5, 0x0d, 0x00, 0x00,
+    };
+
+    // An HTTP response carrying inflateDynamic in chunks of 1, 7, 64 and 300 bytes
+    static const uint8_t inflateChunkedResponse[] = {
+        0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d,
+        0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x61,
+        0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x6a, 0x73, 0x6f, 0x6e, 0x3b,
+        0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x75, 0x74, 0x66, 0x2d, 0x38, 0x0d, 0x0a,
+        0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67,
+        0x3a, 0x20, 0x67, 0x7a, 0x69, 0x70, 0x0d, 0x0a, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x65, 0x72,
+        0x2d, 0x45, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b,
+        0x65, 0x64, 0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20,
+        0x63, 0x6c, 0x6f, 0x73, 0x65, 0x0d, 0x0a, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x1f, 0x0d, 0x0a, 0x37,
+        0x0d, 0x0a, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x0a, 0x34, 0x30, 0x0d, 0x0a, 0x02,
+        0x03, 0x95, 0x96, 0xdd, 0x6a, 0xdb, 0x40, 0x10, 0x46, 0x5f, 0xa5, 0xe8, 0xda, 0x15, 0x3b, 0x33,
+        0xfb, 0xa3, 0xf5, 0x13, 0xf4, 0x01, 0x02, 0x85, 0x96, 0x62, 0x44, 0xa4, 0x36, 0x06, 0x5b, 0x09,
+        0xb6, 0x7c, 0x11, 0x8c, 0xdf, 0xbd, 0x72, 0x69, 0xa8, 0xbe, 0x1d, 0xd3, 0x61, 0xc1, 0x17, 0xc9,
+        0xc6, 0x39, 0x9a, 0xd1, 0xcc, 0x99, 0xd9, 0x6b, 0xf3, 0xfc, 0xd2, 0x4f, 0xd3, 0x78, 0x68, 0x0d,
+        0x0a, 0x31, 0x32, 0x63, 0x0d, 0x0a, 0xb6, 0xd7, 0x66, 0x3f, 0x34, 0x5b, 0x62, 0xf1, 0x21, 0xa6,
+        0x4d, 0x33, 0xf5, 0xc7, 0xb1, 0xd9, 0x36, 0x5f, 0xc7, 0x7e, 0x7e, 0x19, 0x4f, 0x9f, 0xce, 0x73,
+        0x3f, 0xef, 0x5f, 0xa7, 0x66, 0xd3, 0x1c, 0x96, 0x1f, 0xe6, 0xcb, 0x70, 0xff, 0xa3, 0x6b, 0xdd,
+        0xfd, 0xe0, 0x75, 0xfa, 0x85, 0x27, 0x3f, 0xf7, 0xe3, 0x61, 0xa0, 0xe5, 0xd7, 0xa7, 0xf1, 0xf8,
+        0x36, 0x9e, 0xfa, 0xf9, 0x72, 0x1a, 0x3f, 0x8e, 0x79, 0x39, 0xfe, 0x72, 0x39, 0xee, 0x87, 0xfd,
+        0xfc, 0xbe, 0x9c, 0x3d, 0x9f, 0x96, 0x07, 0x8c, 0xc3, 0xae, 0x9f, 0x97, 0x73, 0x76, 0x1c, 0x3e,
+        0x3b, 0x5a, 0x3e, 0x4f, 0xce, 0x6d, 0xff, 0x7c, 0xbe, 0x2d, 0xdf, 0xb9, 0xbc, 0x0d, 0xe6, 0x77,
+        0x0e, 0xfd, 0x79, 0xde, 0x8d, 0xd3, 0x7c, 0x7a, 0xdf, 0xdd, 0xd3, 0xf0, 0xee, 0xb6, 0x3c, 0x6f,
+        0x1c, 0x87, 0x73, 0xb3, 0xfd, 0x7e, 0x7d, 0xf4, 0x14, 0xf9, 0x20, 0xd0, 0x5f, 0xc2, 0xbf, 0x7f,
+        0xa6, 0x55, 0x06, 0x4c, 0x2d, 0xe7, 0x75, 0xec, 0xd2, 0x35, 0xb7, 0xcd, 0xff, 0x89, 0xac, 0x88,
+        0xbc, 0x26, 0x72, 0xeb, 0x3b, 0x20, 0x66, 0x93, 0x28, 0x8a, 0x28, 0x2b, 0x22, 0xe5, 0x36, 0xf1,
+        0x9a, 0xe8, 0xa3, 0x49, 0xf4, 0x8a, 0xe8, 0x31, 0x6b, 0xef, 0xd6, 0xc4, 0x28, 0x26, 0x31, 0x28,
+        0x62, 0xc0, 0xac, 0x83, 0x40, 0x8c, 0xc9, 0x24, 0x46, 0x45, 0x8c, 0x18, 0x63, 0x86, 0xac, 0xa3,
+        0x4d, 0x4c, 0x8a, 0x98, 0xd6, 0x44, 0x69, 0x03, 0x56, 0xc6, 0x7e, 0x8f, 0x9d, 0x22, 0x76, 0x6b,
+        0xa2, 0x6b, 0x09, 0xba, 0x27, 0xb2, 0x49, 0xcc, 0x8a, 0x98, 0xd7, 0xb5, 0xee, 0x5a, 0x97, 0x80,
+        0x48, 0x16, 0x91, 0x9c, 0xee, 0x70, 0x87, 0x41, 0x72, 0x80, 0xb4, 0x6d, 0xe4, 0x03, 0x69, 0x08,
+        0x91, 0x2e, 0x54, 0x46, 0xa9, 0xad, 0x21, 0xc6, 0xc4, 0x97, 0xb8, 0xd6, 0x0d, 0x14, 0x4c, 0xa4,
+        0xd6, 0x86, 0x04, 0xeb, 0xdd, 0x61, 0xbd, 0x6d, 0xa4, 0xf6, 0x86, 0x3c, 0x46, 0x99, 0x3d, 0x44,
+        0xe9, 0x4c, 0xa4, 0x16, 0x87, 0x02, 0xf6, 0xb9, 0x60, 0x0f, 0xd9, 0x48, 0x6d, 0x0e, 0x45, 0x4c,
+        0xdc, 0xd5, 0x0d, 0x0a, 0x31, 0x0d, 0x0a, 0x26, 0x0d, 0x0a, 0x37, 0x0d, 0x0a, 0xae, 0xd5, 0xa1,
+        0x54, 0xcc, 0xa0, 0x08, 0x0d, 0x0a, 0x34, 0x30, 0x0d, 0x0a, 0x51, 0x9a, 0xee, 0x90, 0x76, 0x87,
+        0x3a, 0x7c, 0x97, 0x3e, 0xd6, 0x8d, 0x5e, 0xd2, 0xf2, 0x50, 0x2e, 0xa6, 0x39, 0x24, 0x1e, 0x4c,
+        0x24, 0x6b, 0x7b, 0xd8, 0x15, 0x4d, 0x24, 0x75, 0xad, 0xce, 0xda, 0x1e, 0x26, 0x7c, 0x97, 0xd8,
+        0x44, 0xd1, 0xdc, 0x10, 0xfc, 0x60, 0xe7, 0x30, 0x0a, 0x29, 0x52, 0xb7, 0x22, 0x58, 0xdb, 0xc3,
+        0x82, 0x13, 0x3d, 0x42, 0x79, 0x82, 0x1d, 0xa5, 0xb6, 0x87, 0x0d, 0x0a, 0x61, 0x39, 0x0d, 0x0a,
+        0x8b, 0xb5, 0xe3, 0x60, 0xa4, 0x8b, 0x39, 0x2e, 0x59, 0xdb, 0xc3, 0x01, 0xcb, 0x83, 0x89, 0x8b,
+        0xb9, 0x25, 0x58, 0xdb, 0xc3, 0x11, 0x13, 0xc7, 0x28, 0xa3, 0x69, 0x0f, 0x6b, 0x7b, 0x38, 0x61,
+        0x79, 0x3a, 0x1c, 0xc1, 0xde, 0x44, 0x6a, 0x7b, 0xb8, 0x58, 0x3d, 0x0c, 0xe5, 0xf1, 0xf6, 0xbb,
+        0xd4, 0xf6, 0x70, 0x46, 0x64, 0xc4, 0x28, 0xcd, 0x49, 0x24, 0xda, 0x1e, 0x71, 0xd8, 0xea, 0x21,
+        0xd6, 0x2d, 0x71, 0xd1, 0xf6, 0x08, 0x61, 0x79, 0x8a, 0x56, 0x37, 0xcb, 0x23, 0xda, 0x1e, 0x29,
+        0xae, 0x6c, 0xc5, 0x05, 0xcb, 0x74, 0x5c, 0x1e, 0x5c, 0xd9, 0x04, 0x87, 0x1b, 0x51, 0xdd, 0x08,
+        0x16, 0x6d, 0x8f, 0x14, 0xbb, 0x27, 0xa4, 0xca, 0x28, 0xb5, 0x3d, 0x12, 0x8a, 0x28, 0x2b, 0xf7,
+        0xb8, 0x68, 0x7b, 0xa4, 0xb8, 0xb6, 0xc5, 0x5c, 0xd9, 0x44, 0xda, 0x1e, 0x49, 0x85, 0x90, 0x52,
+        0x77, 0xcb, 0x12, 0x6d, 0x8f, 0x74, 0x88, 0xcc, 0xa9, 0x6e, 0x8f, 0x8b, 0xb6, 0x47, 0x72, 0x81,
+        0xc4, 0x3d, 0x6e, 0x3a, 0xee, 0xb5, 0x3d, 0xbe, 0xb0, 0x27, 0x85, 0x72, 0x9d, 0xfd, 0xb8, 0xfd,
+        0x06, 0x74, 0x07, 0x72, 0x8a, 0xd5, 0x0d, 0x00, 0x00, 0x0d, 0x0a, 0x30, 0x0d, 0x0a, 0x0d, 0x0a,
+    };
+
+    #define INFLATE_FAR_LENGTH         22048      // Length of the text inflateFarReference decodes to
+    #define INFLATE_FAR_DISTANCE       21024      // Distance of its back reference
+
+    // 1 KB of text, 20 KB of filler and the same 1 KB again, which needs a window over 16 KB
+    static const uint8_t inflateFarReference[] = {
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0xdc, 0x5b, 0xae, 0xa5, 0x20,
+        0x10, 0x05, 0xd0, 0x29, 0x81, 0x88, 0xc2, 0x70, 0xe4, 0x21, 0x88, 0x20, 0x22, 0xca, 0x6b, 0xf4,
+        0xf7, 0x0c, 0xa3, 0x93, 0xae, 0xf5, 0x43, 0x02, 0x21, 0x50, 0x3b, 0xf5, 0x5d, 0xcd, 0x8f, 0xaf,
+        0x26, 0x4f, 0x1d, 0x25, 0x77, 0xc8, 0xad, 0xcb, 0x79, 0xa5, 0xc4, 0xad, 0x98, 0xf5, 0xec, 0xdd,
+        0x3b, 0x4a, 0xd3, 0x3d, 0x78, 0x77, 0xab, 0x11, 0xd6, 0x76, 0x6f, 0x58, 0xe1, 0x9e, 0x64, 0x5e,
+        0xe6, 0xbd, 0xed, 0xfb, 0x82, 0x52, 0x9e, 0x11, 0x9b, 0x45, 0xf3, 0xfa, 0x10, 0xa3, 0x51, 0xfa,
+        0x19, 0xfe, 0x9d, 0xb7, 0x54, 0x62, 0x5c, 0xe5, 0xd8, 0xac, 0x57, 0xc5, 0xb3, 0x9c, 0xe8, 0x7e,
+        0x88, 0x2c, 0x35, 0x4a, 0xfa, 0xf6, 0x94, 0x0a, 0x9a, 0x04, 0x77, 0x62, 0x7d, 0x92, 0xa6, 0x07,
+        0xf3, 0x65, 0x52, 0x28, 0xcf, 0x8f, 0x21, 0xf6, 0x34, 0xd4, 0x7d, 0x86, 0xe6, 0xa3, 0xd8, 0x42,
+        0x64, 0x9f, 0x2c, 0xf7, 0x6b, 0xe5, 0xc1, 0xe6, 0xe9, 0xbd, 0xaf, 0x96, 0x15, 0xa7, 0x97, 0xf8,
+        0xd6, 0xd6, 0xed, 0x90, 0x64, 0xd2, 0x68, 0xfa, 0x68, 0xb8, 0xb1, 0x9f, 0xef, 0x67, 0x74, 0x5e,
+        0x4e, 0xf5, 0x2d, 0x68, 0x9a, 0x1f, 0x45, 0xf0, 0x30, 0x9c, 0x20, 0x7e, 0x98, 0x33, 0x25, 0x77,
+        0x45, 0x91, 0x0e, 0x92, 0xba, 0xad, 0xe8, 0x7a, 0xde, 0x69, 0xcf, 0xa3, 0x4d, 0xe2, 0x38, 0xa4,
+        0x7b, 0xf9, 0x77, 0x7f, 0xf5, 0x5c, 0xd5, 0x57, 0x4a, 0xc0, 0x41, 0x6a, 0x63, 0xd7, 0xb6, 0xba,
+        0xc3, 0xf1, 0x18, 0x13, 0x79, 0x5e, 0x46, 0x92, 0xce, 0x6e, 0xd3, 0x55, 0x5e, 0xd4, 0x2f, 0x84,
+        0xe0, 0x3e, 0xfa, 0x68, 0x3b, 0xd5, 0xdf, 0x1c, 0x47, 0xf2, 0xb3, 0xa7, 0xa6, 0x91, 0xe8, 0x79,
+        0xa4, 0x45, 0x2b, 0xf3, 0xfe, 0xfe, 0xf8, 0x6a, 0x36, 0x62, 0xe4, 0xec, 0xad, 0xbb, 0xf3, 0x4d,
+        0x3a, 0x7f, 0xb3, 0x64, 0x53, 0xbc, 0xe5, 0x72, 0x4e, 0xfd, 0xc4, 0x88, 0xec, 0x46, 0x5c, 0x7c,
+        0xcf, 0x75, 0xbd, 0xea, 0x79, 0x2e, 0xa1, 0xeb, 0x40, 0x5e, 0x31, 0x55, 0xc2, 0x05, 0xd7, 0xd8,
+        0xbe, 0xfd, 0x1b, 0xf4, 0x65, 0xeb, 0xfa, 0x98, 0xb8, 0x97, 0x18, 0xf7, 0x7c, 0x48, 0xa3, 0x3e,
+        0xf4, 0x0e, 0x16, 0xca, 0x2a, 0x5a, 0xaf, 0xc6, 0x8c, 0xeb, 0x17, 0xec, 0x3b, 0xd0, 0xf8, 0x90,
+        0xff, 0x64, 0x7c, 0xcf, 0x45, 0x26, 0x12, 0xe2, 0xce, 0x55, 0xee, 0xeb, 0xf8, 0x0a, 0x65, 0xe8,
+        0xb9, 0x64, 0xd5, 0xa2, 0xe9, 0xf9, 0x10, 0xee, 0x68, 0xde, 0x3d, 0xe5, 0x39, 0xda, 0x43, 0x1a,
+        0x4e, 0xf7, 0x6f, 0x7d, 0x2f, 0x85, 0x16, 0xdb, 0x2e, 0x71, 0xb1, 0xeb, 0x78, 0x0f, 0x42, 0xb1,
+        0xca, 0xea, 0xab, 0xf6, 0x5c, 0x5a, 0xe9, 0x64, 0x6b, 0xc8, 0xdb, 0x50, 0x7f, 0x09, 0xff, 0x8a,
+        0xda, 0x8f, 0x5c, 0xc7, 0xd4, 0xd5, 0xf6, 0xbe, 0x1f, 0x3b, 0x68, 0x60, 0x6d, 0xc2, 0x8e, 0x65,
+        0x63, 0xe5, 0xdc, 0xeb, 0xb1, 0x3a, 0x75, 0x3f, 0x42, 0x4f, 0x2e, 0x96, 0x52, 0x9d, 0x53, 0xf5,
+        0x77, 0x47, 0x86, 0xc6, 0xc7, 0xad, 0x2f, 0x4c, 0xfb, 0x13, 0xaa, 0x56, 0x25, 0x38, 0x17, 0x3f,
+        0xdc, 0x78, 0x7c, 0x7b, 0x10, 0x5a, 0xcc, 0x4a, 0x9a, 0x45, 0x9b, 0x60, 0x5b, 0x61, 0x92, 0x21,
+        0x71, 0xea, 0x28, 0xb8, 0xf4, 0x87, 0x49, 0x7a, 0x6e, 0xb6, 0x6d, 0xee, 0xae, 0x76, 0xce, 0x57,
+        0xef, 0x6d, 0xd2, 0xd3, 0xb2, 0xc7, 0x5a, 0xb6, 0xd5, 0x58, 0xc3, 0x36, 0x9e, 0x78, 0xa0, 0xc6,
+        0xec, 0x7d, 0xf3, 0xe5, 0x78, 0xcc, 0x23, 0x47, 0x56, 0x06, 0x8f, 0xb3, 0x6e, 0xce, 0x72, 0xba,
+        0xd4, 0x88, 0xf3, 0x72, 0x31, 0xe2, 0x4c, 0x45, 0x8f, 0x2d, 0x71, 0x88, 0x86, 0xf0, 0x8a, 0xa8,
+        0xdf, 0x4f, 0xa6, 0x55, 0xdc, 0xd5, 0x2c, 0xd2, 0x26, 0xad, 0x39, 0x5f, 0x7c, 0xbf, 0x0e, 0xfd,
+        0xda, 0xaf, 0xed, 0xde, 0xe1, 0x90, 0xc3, 0x94, 0x8f, 0x3e, 0x96, 0x43, 0xdc, 0x2b, 0xff, 0xe8,
+        0x63, 0xa7, 0xf1, 0x0b, 0xfd, 0x15, 0x77, 0x17, 0x5d, 0x0c, 0x4d, 0xf5, 0x96, 0x9b, 0x61, 0xe4,
+        0xd2, 0x37, 0xfa, 0x10, 0x29, 0xb3, 0xc6, 0x8c, 0xd9, 0x34, 0xed, 0x84, 0x7a, 0xb3, 0xe1, 0xdf,
+        0xd6, 0x72, 0x4b, 0x3a, 0xce, 0xb7, 0x1e, 0xcb, 0xf2, 0x70, 0xcd, 0x02, 0xb2, 0xa3, 0x5a, 0x8d,
+        0xdd, 0xe7, 0x90, 0x6c, 0x52, 0xbc, 0x27, 0x6f, 0x22, 0x91, 0x3c, 0x65, 0x34, 0x54, 0x48, 0xe7,
+        0x2e, 0x7f, 0x07, 0x7b, 0x16, 0xb6, 0x9e, 0xb7, 0xb1, 0x35, 0x48, 0x93, 0x52, 0x9b, 0xf1, 0x4c,
+        0x2a, 0x4f, 0x48, 0xc5, 0x17, 0xa1, 0x5f, 0x9b, 0x9a, 0x05, 0x6d, 0x4f, 0x50, 0xe9, 0x48, 0xef,
+        0x47, 0xd5, 0x27, 0xd9, 0xf9, 0x44, 0xe4, 0xb4, 0x78, 0x78, 0xdc, 0xcf, 0xd5, 0x72, 0xb5, 0x9e,
+        0xfb, 0x2f, 0xdf, 0x2a, 0xfc, 0x6d, 0xd9, 0xe2, 0xc2, 0x5c, 0x96, 0xcc, 0x30, 0xc2, 0xa7, 0x91,
+        0x24, 0x62, 0xcc, 0xca, 0xb6, 0x8c, 0x72, 0x11, 0xdf, 0xdf, 0x56, 0x36, 0x35, 0x2e, 0x77, 0x17,
+        0x4b, 0xee, 0x5f, 0x65, 0xb2, 0x08, 0xaf, 0xd6, 0x63, 0x5c, 0x41, 0xff, 0x5e, 0x0d, 0x3e, 0xc4,
+        0x18, 0xd2, 0x32, 0x9f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xc0, 0xbf, 0x01, 0xe6, 0x43, 0xc2, 0x7c, 0x48, 0x98, 0x0f, 0xf9, 0xdf,
+        0xce, 0x87, 0xfc, 0x03, 0x0b, 0xe7, 0x15, 0x33, 0x20, 0x56, 0x00, 0x00,
+    };
+
+#endif //InflateFixtures_h
@@ -0,0 +1,130 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  Host test and benchmark of the gzip decoder.  Decodes the recorded streams of InflateFixtures.h (stored, fixed
+  and dynamic Huffman blocks, a corrupt CRC-32, a back reference beyond a small window), reads a chunked
+  compressed response through readRaw(), and times the decoding of the dynamic stream.
+
+  Build and run from the root of the library:
+    g++ -std=gnu++14 -O2 -DPLATFORM_ID=12 -DTS_GZIP_RESPONSES -Iextras/host -Isrc extras/host/InflateTest.cpp -o InflateTest -pthread
+    ./InflateTest
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#include "ThingSpeak.h"
+#include "InflateFixtures.h"
+
+#define BENCHMARK_MS       1000    // How long to decode the dynamic stream over and over
+
+// Compressed bytes from an array, the SOURCE of ThingSpeakInflater::gunzip()
+class ArraySource
+{
+  public:
+    ArraySource(const uint8_t * data, size_t length) : data(data), length(length), position(0) {}
+
+    int read()
+    {
+        return (this->position < this->length) ? this->data[this->position++] : -1;
+    }
+
+  private:
+    const uint8_t * data;
+    size_t length;
+    size_t position;
+};
+
+// A server connection that answers with a recorded response
+class RecordedClient : public Client
+{
+  public:
+    RecordedClient(const uint8_t * response, size_t length) : response(response), length(length), position(0), open(false) {}
+
+    int connect(IPAddress, uint16_t, network_interface_t = 0) override { return openConnection(); }
+    int connect(const char *, uint16_t, network_interface_t = 0) override { return openConnection(); }
+    size_t write(uint8_t) override { return 1; }
+    size_t write(const uint8_t *, size_t size) override { return size; }
+    int available() override { return this->open ? (int)(this->length - this->position) : 0; }
+    int read() override { return (available() > 0) ? this->response[this->position++] : -1; }
+    int read(uint8_t * buffer, size_t size) override
+    {
+        size_t count = 0;
+        while(count < size && available() > 0) buffer[count++] = this->response[this->position++];
+        return (count > 0) ? (int)count : -1;
+    }
+    int peek() override { return (available() > 0) ? this->response[this->position] : -1; }
+    void flush() override {}
+    void stop() override { this->open = false; }
+    uint8_t connected() override { return available() > 0; }
+    operator bool() override { return this->open; }
+    using Print::write;
+
+  private:
+    int openConnection()
+    {
+        this->position = 0;
+        this->open = true;
+        return 1;
+    }
+
+    const uint8_t * response;
+    size_t length;
+    size_t position;
+    bool open;
+};
+
+static int failures = 0;
+
+static void check(bool passed, const char * what)
+{
+    printf("%s: %s\n", passed ? "PASS" : "FAIL", what);
+    if(!passed) failures++;
+}
+
+template <size_t WINDOW_SIZE>
+static int decode(const uint8_t * data, size_t length, String & text)
+{
+    static ThingSpeakInflater<WINDOW_SIZE> inflater;
+    ArraySource source(data, length);
+    ThingSpeakStringPrinter out(text);
+    text = "";
+    return inflater.gunzip(source, out);
+}
+
+int main()
+{
+    String text;
+    check(decode<TS_INFLATE_WINDOW_SIZE>(inflateStored, sizeof(inflateStored), text) == TS_INFLATE_OK && text == inflateFeedText, "stored blocks");
+    check(decode<TS_INFLATE_WINDOW_SIZE>(inflateFixed, sizeof(inflateFixed), text) == TS_INFLATE_OK && text == inflateFeedText, "fixed Huffman blocks");
+    check(decode<TS_INFLATE_WINDOW_SIZE>(inflateDynamic, sizeof(inflateDynamic), text) == TS_INFLATE_OK && text == inflateFeedText, "dynamic Huffman blocks");
+    check(decode<TS_INFLATE_WINDOW_SIZE>(inflateCorruptCRC, sizeof(inflateCorruptCRC), text) == TS_INFLATE_BAD_CHECK, "corrupt CRC-32 is rejected");
+    check(decode<TS_INFLATE_WINDOW_SIZE>(inflateDynamic, sizeof(inflateDynamic) / 2, text) == TS_INFLATE_END_OF_INPUT, "truncated stream is rejected");
+    check(decode<32768>(inflateFarReference, sizeof(inflateFarReference), text) == TS_INFLATE_OK && text.length() == INFLATE_FAR_LENGTH,
+          "back reference of 21 KB with a 32 KB window");
+    check(decode<4096>(inflateFarReference, sizeof(inflateFarReference), text) == TS_INFLATE_BAD_DISTANCE, "back reference of 21 KB with a 4 KB window is rejected");
+
+    // The whole path of a read: chunked transfer encoding, gzip, and the window allocated for the response
+    ThingSpeakClass thingSpeak;
+    RecordedClient client(inflateChunkedResponse, sizeof(inflateChunkedResponse));
+    thingSpeak.begin(client);
+    String response = thingSpeak.readRaw(1234567, "/feeds.json?results=40");
+    check(thingSpeak.getLastReadStatus() == TS_OK_SUCCESS && response == inflateFeedText, "chunked compressed response through readRaw()");
+    // The chunk size lines count too.  The decoder stops at the gzip trailer, before the CRLF and the last chunk "0".
+    std::string recorded((const char *)inflateChunkedResponse, sizeof(inflateChunkedResponse));
+    unsigned long bodyLength = recorded.size() - (recorded.find("\r\n\r\n") + 4);
+    check(thingSpeak.getLastResponseWireLength() == bodyLength - strlen("\r\n0\r\n\r\n"), "getLastResponseWireLength() counts the bytes of the chunked body");
+
+    unsigned long decoded = 0;
+    unsigned long startedAt = millis();
+    while(millis() - startedAt < BENCHMARK_MS)
+    {
+        decode<TS_INFLATE_WINDOW_SIZE>(inflateDynamic, sizeof(inflateDynamic), text);
+        decoded += text.length();
+    }
+    unsigned long elapsed = millis() - startedAt;
+    printf("decoded %.1f MB/s of the dynamic stream, %u bytes of heap per compressed response with a %u byte window\n",
+           decoded / 1000.0 / elapsed, (unsigned int)sizeof(ThingSpeakInflater<TS_INFLATE_WINDOW_SIZE>), (unsigned int)TS_INFLATE_WINDOW_SIZE);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,241 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  Client over a Linux TCP socket, the host counterpart of TCPClient.  connect() blocks until the connection is
+  made, like TCPClient, but reads never block, so readBatch() and writeBatch() can wait on several clients at once.
+  redirect() sends every connection to another host and port, to point the library at a local emulator.
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#ifndef LinuxTCPClient_h
+    #define LinuxTCPClient_h
+
+    #include "application.h"
+
+    #include <cerrno>
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <netdb.h>
+    #include <sys/ioctl.h>
+    #include <sys/socket.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+
+    #define TS_HOST_CONNECT_TIMEOUT_MS 5000   // Longest connect(), the Device OS TCPClient gives up after about as long
+
+    class LinuxTCPClient : public Client
+    {
+      public:
+        LinuxTCPClient()
+        {
+            this->socket = -1;
+            this->redirectHost = NULL;
+            this->redirectPort = 0;
+        }
+
+        ~LinuxTCPClient()
+        {
+            stop();
+        }
+
+        // Connects to host and port whatever the library asks for, NULL to connect where it asks.  host is not copied.
+        void redirect(const char * host, uint16_t port)
+        {
+            this->redirectHost = host;
+            this->redirectPort = port;
+        }
+
+        int connect(IPAddress ip, uint16_t port, network_interface_t = 0) override
+        {
+            char host[16];
+            snprintf(host, sizeof(host), "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+            return openSocket(host, port);
+        }
+
+        int connect(const char * host, uint16_t port, network_interface_t = 0) override
+        {
+            return openSocket(host, port);
+        }
+
+        size_t write(uint8_t b) override
+        {
+            return write(&b, 1);
+        }
+
+        // Waits for room in the send buffer, so the whole request is sent unless the connection fails
+        size_t write(const uint8_t * buffer, size_t size) override
+        {
+            size_t sent = 0;
+            while(this->socket >= 0 && sent < size)
+            {
+                ssize_t length = ::send(this->socket, buffer + sent, size - sent, MSG_NOSIGNAL);
+                if(length > 0)
+                {
+                    sent += length;
+                }
+                else if(length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                {
+                    struct pollfd ready = {this->socket, POLLOUT, 0};
+                    if(::poll(&ready, 1, TS_HOST_CONNECT_TIMEOUT_MS) <= 0)
+                    {
+                        break;
+                    }
+                }
+                else if(length < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                else
+                {
+                    break;
+                }
+            }
+            return sent;
+        }
+
+        int available() override
+        {
+            int length = 0;
+            if(this->socket < 0 || ::ioctl(this->socket, FIONREAD, &length) < 0)
+            {
+                return 0;
+            }
+            return length;
+        }
+
+        int read() override
+        {
+            uint8_t b;
+            return (read(&b, 1) == 1) ? b : -1;
+        }
+
+        int read(uint8_t * buffer, size_t size) override
+        {
+            if(this->socket < 0)
+            {
+                return -1;
+            }
+            ssize_t length = ::recv(this->socket, buffer, size, MSG_DONTWAIT);
+            return (length > 0) ? (int)length : -1;
+        }
+
+        int peek() override
+        {
+            uint8_t b;
+            if(this->socket < 0 || ::recv(this->socket, &b, 1, MSG_DONTWAIT | MSG_PEEK) != 1)
+            {
+                return -1;
+            }
+            return b;
+        }
+
+        void flush() override
+        {
+        }
+
+        void stop() override
+        {
+            if(this->socket >= 0)
+            {
+                ::close(this->socket);
+                this->socket = -1;
+            }
+        }
+
+        // True while the server has not closed the connection, or until what it sent before closing is read
+        uint8_t connected() override
+        {
+            if(this->socket < 0)
+            {
+                return false;
+            }
+            uint8_t b;
+            ssize_t length = ::recv(this->socket, &b, 1, MSG_DONTWAIT | MSG_PEEK);
+            if(length > 0)
+            {
+                return true;
+            }
+            return length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR);
+        }
+
+        operator bool() override
+        {
+            return this->socket >= 0;
+        }
+
+        using Print::write;
+
+      private:
+        int openSocket(const char * host, uint16_t port)
+        {
+            stop();
+            if(NULL != this->redirectHost)
+            {
+                host = this->redirectHost;
+                port = this->redirectPort;
+            }
+
+            struct addrinfo hints;
+            memset(&hints, 0, sizeof(hints));
+            hints.ai_family = AF_UNSPEC;
+            hints.ai_socktype = SOCK_STREAM;
+            char service[8];
+            snprintf(service, sizeof(service), "%u", port);
+            struct addrinfo * addresses = NULL;
+            if(::getaddrinfo(host, service, &hints, &addresses) != 0)
+            {
+                return 0;
+            }
+
+            for(struct addrinfo * address = addresses; NULL != address && this->socket < 0; address = address->ai_next)
+            {
+                int candidate = ::socket(address->ai_family, address->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, address->ai_protocol);
+                if(candidate < 0)
+                {
+                    continue;
+                }
+                if(waitConnect(candidate, address))
+                {
+                    int noDelay = 1;
+                    ::setsockopt(candidate, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+                    this->socket = candidate;
+                }
+                else
+                {
+                    ::close(candidate);
+                }
+            }
+            ::freeaddrinfo(addresses);
+            return (this->socket >= 0) ? 1 : 0;
+        }
+
+        bool waitConnect(int candidate, const struct addrinfo * address)
+        {
+            if(::connect(candidate, address->ai_addr, address->ai_addrlen) == 0)
+            {
+                return true;
+            }
+            if(errno != EINPROGRESS)
+            {
+                return false;
+            }
+            struct pollfd ready = {candidate, POLLOUT, 0};
+            if(::poll(&ready, 1, TS_HOST_CONNECT_TIMEOUT_MS) <= 0)
+            {
+                return false;
+            }
+            int error = 0;
+            socklen_t length = sizeof(error);
+            return ::getsockopt(candidate, SOL_SOCKET, SO_ERROR, &error, &length) == 0 && error == 0;
+        }
+
+        int socket;
+        const char * redirectHost;
+        uint16_t redirectPort;
+    };
+
+#endif //LinuxTCPClient_h
@@ -0,0 +1,84 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  Host stress test of the event log ring.  Several threads record events as fast as they can while the main
+  thread drains them, so the ring is overwritten constantly.  Every record drained must be one that was made,
+  whole, and in the order it was made; the ones lost to overwriting show as gaps in the record numbers.
+
+  Build and run under ThreadSanitizer from the root of the library:
+    g++ -std=gnu++14 -fsanitize=thread -g -O1 -DPLATFORM_ID=12 -Iextras/host -Isrc extras/host/LogStress.cpp -o LogStress -pthread
+    ./LogStress
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#include "ThingSpeakLog.h"
+
+#define RECORDERS          4
+#define RECORDS_EACH       200000
+
+static ThingSpeakLog<32> eventLog;
+static std::atomic<int> recording(RECORDERS);
+
+// Each thread logs its number as the event and a count, with b derived from both so a torn record shows
+static void recordEvents(int recorder)
+{
+    for(long count = 0; count < RECORDS_EACH; count++)
+    {
+        eventLog.record(TS_LOG_LEVEL_INFO, (uint8_t)recorder, count, count * 7 + recorder);
+    }
+    recording--;
+}
+
+int main()
+{
+    std::thread recorders[RECORDERS];
+    for(int i = 0; i < RECORDERS; i++)
+    {
+        recorders[i] = std::thread(recordEvents, i);
+    }
+
+    long lastCount[RECORDERS];
+    for(int i = 0; i < RECORDERS; i++)
+    {
+        lastCount[i] = -1;
+    }
+    unsigned long drained = 0;
+    unsigned long torn = 0;
+    unsigned long outOfOrder = 0;
+    logRecord entry;
+    bool finished = false;
+    while(!finished)
+    {
+        finished = (recording.load() == 0);
+        while(eventLog.drain(entry))
+        {
+            drained++;
+            if(entry.level != TS_LOG_LEVEL_INFO || entry.event >= RECORDERS || entry.b != entry.a * 7 + entry.event)
+            {
+                torn++;
+                continue;
+            }
+            if(entry.a <= lastCount[entry.event])
+            {
+                outOfOrder++;
+            }
+            lastCount[entry.event] = entry.a;
+        }
+    }
+    for(int i = 0; i < RECORDERS; i++)
+    {
+        recorders[i].join();
+    }
+
+    bool lastDrained = true;
+    for(int i = 0; i < RECORDERS; i++)
+    {
+        lastDrained = lastDrained && lastCount[i] <= RECORDS_EACH - 1;
+    }
+    printf("%lu of %d records drained, %lu torn, %lu out of order\n", drained, RECORDERS * RECORDS_EACH, torn, outOfOrder);
+    printf("%s: no record drained torn or out of order\n", (torn == 0 && outOfOrder == 0 && lastDrained) ? "PASS" : "FAIL");
+    return (torn == 0 && outOfOrder == 0 && lastDrained) ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  Host test of readBatch() over real sockets.  The emulator is served on a local TCP port with a fixed latency,
+  and the reads go over LinuxTCPClient connections, so the responses of the batch overlap on the wire the way
+  they do with TCPClient on a device.
+
+  Build and run from the root of the library:
+    g++ -std=gnu++14 -fsanitize=thread -g -O1 -DPLATFORM_ID=12 -Iextras/host -Isrc extras/host/ReadBatchSockets.cpp -o ReadBatchSockets -pthread
+    ./ReadBatchSockets
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#include "EmulatorServer.h"
+#include "LinuxTCPClient.h"
+
+#define CHANNELS       8
+#define CLIENTS        4
+#define LATENCY_MS     300     // Each response is sent this long after its request
+
+static ThingSpeakEmulator emulator;
+static ThingSpeakEmulatorServer server(emulator);
+
+static int failures = 0;
+
+static void check(bool passed, const char * what)
+{
+    printf("%s: %s\n", passed ? "PASS" : "FAIL", what);
+    if(!passed) failures++;
+}
+
+int main()
+{
+    static const char * writeKeys[CHANNELS] = {"KEY1", "KEY2", "KEY3", "KEY4", "KEY5", "KEY6", "KEY7", "KEY8"};
+    for(unsigned long channel = 1; channel <= CHANNELS; channel++)
+    {
+        emulator.addChannel(channel, writeKeys[channel - 1], NULL);
+    }
+    emulator.setRateLimit(0);
+    if(!server.start(0))
+    {
+        printf("FAIL: could not listen on a local port\n");
+        return 1;
+    }
+
+    ThingSpeakClass thingSpeak;
+    LinuxTCPClient writer;
+    writer.redirect("127.0.0.1", server.getPort());
+    thingSpeak.begin(writer);
+    // With a time budget the response body is read up to its length instead of waiting out the stream timeout
+    thingSpeak.setTimeBudget(TIMEOUT_MS_SERVERRESPONSE);
+    bool written = true;
+    for(unsigned long channel = 1; channel <= CHANNELS; channel++)
+    {
+        written = (thingSpeak.writeField(channel, 1, (long)(channel * 100), writeKeys[channel - 1]) == TS_OK_SUCCESS) && written;
+    }
+    check(written, "one value written to each channel over a socket");
+
+    {
+        std::lock_guard<std::mutex> guard(server.getLock());
+        emulator.setLatency(LATENCY_MS, LATENCY_MS);
+    }
+    LinuxTCPClient pool[CLIENTS];
+    Client * clients[CLIENTS];
+    for(unsigned int i = 0; i < CLIENTS; i++)
+    {
+        pool[i].redirect("127.0.0.1", server.getPort());
+        clients[i] = &pool[i];
+    }
+    readRequest requests[CHANNELS];
+    for(unsigned int i = 0; i < CHANNELS; i++)
+    {
+        requests[i].channelNumber = i + 1;
+        requests[i].field = 1;
+        requests[i].URLSuffix = NULL;
+        requests[i].readAPIKey = NULL;
+    }
+
+    unsigned long startedAt = millis();
+    unsigned int succeeded = thingSpeak.readBatch(requests, CHANNELS, clients, CLIENTS);
+    unsigned long elapsed = millis() - startedAt;
+    printf("%u of %u reads in %lu ms over %u clients, %u ms each\n", succeeded, CHANNELS, elapsed, CLIENTS, LATENCY_MS);
+
+    bool values = true;
+    for(unsigned int i = 0; i < CHANNELS; i++)
+    {
+        values = values && requests[i].status == TS_OK_SUCCESS && requests[i].response.toInt() == (long)((i + 1) * 100);
+    }
+    check(succeeded == CHANNELS, "every read of the batch succeeded");
+    check(values, "every read returned the value written to its channel");
+    // One read after the other would take CHANNELS * LATENCY_MS
+    check(elapsed < 2 * (CHANNELS / CLIENTS) * LATENCY_MS, "reads on different clients overlapped");
+
+    server.stop();
+    return (failures == 0) ? 0 : 1;
+}
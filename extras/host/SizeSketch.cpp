@@ -0,0 +1,52 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  The sketch measured by extras/size-report.sh: it writes two integer fields, which every combination of the
+  TS_DISABLE_* defines still supports.  With SIZE_BASELINE defined it leaves the library out, so the difference
+  between the two builds is what the library costs the sketch.
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#include "ThingSpeak.h"
+
+// A connection that accepts everything and never answers, so nothing but the library is measured
+class NullClient : public Client
+{
+  public:
+    int connect(IPAddress, uint16_t, network_interface_t = 0) override { return 1; }
+    int connect(const char *, uint16_t, network_interface_t = 0) override { return 1; }
+    size_t write(uint8_t) override { return 1; }
+    size_t write(const uint8_t *, size_t size) override { return size; }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int read(uint8_t *, size_t) override { return -1; }
+    int peek() override { return -1; }
+    void flush() override {}
+    void stop() override {}
+    uint8_t connected() override { return 0; }
+    operator bool() override { return true; }
+    using Print::write;
+};
+
+NullClient client;
+
+#ifndef SIZE_BASELINE
+ThingSpeakClass thingSpeak;
+#endif
+
+int main(int argc, char * argv[])
+{
+#ifndef SIZE_BASELINE
+    thingSpeak.begin(client);
+    thingSpeak.setField(1, (long)argc);
+    thingSpeak.setField(2, (long)millis());
+    return thingSpeak.writeFields(31461, argv[0]);
+#else
+    client.connect("api.thingspeak.com", 80);
+    client.print(argv[0]);
+    return argc;
+#endif
+}
@@ -0,0 +1,126 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  Host stress test of the staging queue.  A producer thread queues values with queueField() and queueSample()
+  as fast as it can while the main thread drains them and writes them to a ThingSpeakEmulator.  Every value the
+  producer was told was queued must reach the channel exactly once and in order, and every value it was told
+  was dropped must be counted by getQueueDropCount().
+
+  Build and run under ThreadSanitizer from the root of the library:
+    g++ -std=gnu++14 -fsanitize=thread -g -O1 -DPLATFORM_ID=12 -Iextras/host -Isrc extras/host/StagingQueueStress.cpp -o StagingQueueStress -pthread
+    ./StagingQueueStress
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#include "ThingSpeakEmulator.h"
+
+#define CHANNEL_NUMBER     1
+#define WRITE_API_KEY      "WRITEKEY"
+#define SAMPLES            200000  // Iterations of the producer, small enough that every sum is exact in a float
+#define DRAINS_PER_WRITE   64      // drainQueuedFields() calls between writes
+
+static ThingSpeakClass thingSpeak;
+static ThingSpeakEmulator server;
+static ThingSpeakEmulatedClient client;
+
+static std::atomic<bool> producerDone(false);
+static unsigned long queued[3];        // Values accepted by the queue, per field
+static unsigned long rejected;         // Values the queue reported as dropped
+static double queuedSum;               // Sum of the field 2 samples accepted
+static long lastQueued = -1;           // Last field 3 value accepted
+
+static void produce()
+{
+    for(long i = 0; i < SAMPLES; i++)
+    {
+        float sample = (float)(i % 7 + 1);
+        unsigned long rejectedBefore = rejected;
+        if(thingSpeak.queueSample(1, 1.0f) == TS_ERR_QUEUE_FULL) rejected++; else queued[0]++;
+        if(thingSpeak.queueSample(2, sample) == TS_ERR_QUEUE_FULL) rejected++; else { queued[1]++; queuedSum += sample; }
+        if(thingSpeak.queueField(3, i) == TS_ERR_QUEUE_FULL) rejected++; else { queued[2]++; lastQueued = i; }
+        // Give the consumer a chance to catch up, so both the full and the not full paths are hit often
+        if(rejected != rejectedBefore) std::this_thread::yield();
+    }
+    producerDone.store(true);
+}
+
+static int failures = 0;
+
+static void check(bool passed, const char * what)
+{
+    printf("%s: %s\n", passed ? "PASS" : "FAIL", what);
+    if(!passed) failures++;
+}
+
+int main()
+{
+    server.addChannel(CHANNEL_NUMBER, WRITE_API_KEY, NULL);
+    server.setRateLimit(0);
+    client.attach(&server);
+    thingSpeak.begin(client);
+    // With a time budget the response body is read up to its length instead of waiting out the stream timeout
+    thingSpeak.setTimeBudget(TIMEOUT_MS_SERVERRESPONSE);
+    thingSpeak.setSampleReduction(1, TS_REDUCE_SUM);
+    thingSpeak.setSampleReduction(2, TS_REDUCE_SUM);
+
+    unsigned long dropsBefore = thingSpeak.getQueueDropCount();
+    unsigned long applied = 0;
+    unsigned long written[3] = {0, 0, 0};
+    double writtenSum = 0;
+    long lastWritten = -1;
+    bool inOrder = true;
+    long entriesRead = 0;
+    int writeErrors = 0;
+
+    std::thread producer(produce);
+    for(unsigned long pass = 1; ; pass++)
+    {
+        bool done = producerDone.load();
+        unsigned int count = thingSpeak.drainQueuedFields();
+        applied += count;
+        if(pass % DRAINS_PER_WRITE == 0 || (done && count == 0))
+        {
+            // writeFields() drains again before it writes, count what the emulator stored rather than what was drained
+            int status = thingSpeak.writeFields(CHANNEL_NUMBER, WRITE_API_KEY);
+            if(status == TS_OK_SUCCESS)
+            {
+                const emulatedChannel * channel = server.getChannel(CHANNEL_NUMBER);
+                if(channel->lastEntryID != entriesRead + 1) inOrder = false;
+                entriesRead = channel->lastEntryID;
+                const emulatedEntry & entry = channel->entries[(entriesRead - 1) % TS_EMULATOR_FEED_LENGTH];
+                if(entry.fields[0].length() > 0) written[0] += (unsigned long)entry.fields[0].toFloat();
+                if(entry.fields[1].length() > 0) writtenSum += entry.fields[1].toFloat();
+                if(entry.fields[2].length() > 0)
+                {
+                    long value = entry.fields[2].toInt();
+                    if(value <= lastWritten) inOrder = false;
+                    lastWritten = value;
+                    written[2]++;
+                }
+            }
+            else if(status != TS_ERR_NOT_INSERTED && status != TS_ERR_SETFIELD_NOT_CALLED)
+            {
+                writeErrors++;
+            }
+        }
+        if(done && count == 0 && thingSpeak.drainQueuedFields() == 0) break;
+        if(count == 0) std::this_thread::yield();
+    }
+    producer.join();
+    applied += thingSpeak.drainQueuedFields();
+
+    unsigned long accepted = queued[0] + queued[1] + queued[2];
+    printf("%lu values queued, %lu dropped, %lu applied, %ld entries written\n", accepted, rejected, applied, entriesRead);
+    check(accepted + rejected == 3UL * SAMPLES, "every queue call accepted or dropped the value");
+    check(thingSpeak.getQueueDropCount() - dropsBefore == rejected, "getQueueDropCount() counts every dropped value");
+    check(applied == accepted, "every accepted value drained exactly once");
+    check(writeErrors == 0, "every write succeeded");
+    check(written[0] == queued[0], "field 1 sample count written matches the samples queued");
+    check(writtenSum == queuedSum, "field 2 sample sum written matches the samples queued");
+    check(inOrder, "field 3 values written in the order queued");
+    check(lastWritten == lastQueued, "last field 3 value written is the last one queued");
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,167 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  Host test of the worker thread queue.  Requests are queued faster than a slow emulator answers them, so newer
+  requests drop older ones, and the test checks that every callback runs on the worker thread, after its request
+  is done, including the -503 of a dropped request, that a callback can queue another request, and that a
+  critical request stops waiting for room after TS_WORKER_CRITICAL_WAIT_MS.
+
+  Build and run from the root of the library:
+    g++ -std=gnu++14 -fsanitize=thread -g -O1 -DPLATFORM_ID=12 -DTS_WORKER_CRITICAL_WAIT_MS=500 -Iextras/host -Isrc extras/host/WorkerQueueTest.cpp -o WorkerQueueTest -pthread
+    ./WorkerQueueTest
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#include "ThingSpeakEmulator.h"
+
+#define CHANNEL_NUMBER     1
+#define WRITE_API_KEY      "WRITEKEY"
+#define LATENCY_MS         200
+#define BULK_WRITES        3       // Fill the queue behind the first write, then are dropped by normal writes
+
+static ThingSpeakClass thingSpeak;
+static ThingSpeakEmulator emulator;
+static ThingSpeakEmulatedClient client;
+static std::thread::id mainThread;
+
+// What one callback saw
+typedef struct callbackResultRecord
+{
+    ThingSpeakFuture future;
+    std::atomic<bool> futureSet;       // future was stored after the call returned
+    std::atomic<bool> called;
+    int status;
+    bool onMainThread;
+    bool futureReady;                  // The future of the request was ready inside the callback
+}callbackResult;
+
+static callbackResult normalResult;
+static callbackResult bulkResults[BULK_WRITES];
+static ThingSpeakFuture chainedWrite;
+static std::atomic<bool> chainedQueued(false);
+
+static void recordCallback(int status, const String &, void * context)
+{
+    callbackResult * result = (callbackResult *)context;
+    while(!result->futureSet.load())
+    {
+        delay(1);
+    }
+    result->status = status;
+    result->onMainThread = (std::this_thread::get_id() == mainThread);
+    result->futureReady = result->future.isReady();
+    result->called.store(true);
+}
+
+// Queues another write from inside a callback
+static void chainCallback(int status, const String & response, void * context)
+{
+    recordCallback(status, response, context);
+    chainedWrite = thingSpeak.writeRawAsync(CHANNEL_NUMBER, "field1=4", WRITE_API_KEY);
+    chainedQueued.store(true);
+}
+
+static int failures = 0;
+
+static void check(bool passed, const char * what)
+{
+    printf("%s: %s\n", passed ? "PASS" : "FAIL", what);
+    if(!passed) failures++;
+}
+
+static bool waitFor(std::atomic<bool> & flag)
+{
+    unsigned long startedAt = millis();
+    while(!flag.load() && millis() - startedAt < 10000)
+    {
+        delay(5);
+    }
+    return flag.load();
+}
+
+int main()
+{
+    mainThread = std::this_thread::get_id();
+    emulator.addChannel(CHANNEL_NUMBER, WRITE_API_KEY, NULL);
+    emulator.setRateLimit(0);
+    emulator.setLatency(LATENCY_MS, LATENCY_MS);
+    client.attach(&emulator);
+    thingSpeak.begin(client);
+    thingSpeak.setTimeBudget(TIMEOUT_MS_SERVERRESPONSE);
+    if(!thingSpeak.beginWorker())
+    {
+        printf("FAIL: the worker thread did not start\n");
+        return 1;
+    }
+
+    // One normal write, bulk writes to different channels behind it, then normal writes that drop the bulk writes
+    normalResult.future = thingSpeak.writeRawAsync(CHANNEL_NUMBER, "field1=1", WRITE_API_KEY, chainCallback, &normalResult);
+    normalResult.futureSet.store(true);
+    for(unsigned int i = 0; i < BULK_WRITES; i++)
+    {
+        thingSpeak.setPriority(TS_PRIORITY_BULK);
+        bulkResults[i].future = thingSpeak.writeRawAsync(CHANNEL_NUMBER + 1 + i, "field1=2", WRITE_API_KEY, recordCallback, &bulkResults[i]);
+        bulkResults[i].futureSet.store(true);
+    }
+    ThingSpeakFuture normalWrites[BULK_WRITES];
+    for(unsigned int i = 0; i < BULK_WRITES; i++)
+    {
+        normalWrites[i] = thingSpeak.writeRawAsync(CHANNEL_NUMBER, "field1=3", WRITE_API_KEY);
+    }
+    bool allCalled = true;
+    for(unsigned int i = 0; i < BULK_WRITES; i++)
+    {
+        allCalled = waitFor(bulkResults[i].called) && allCalled;
+    }
+    check(allCalled, "every callback was called");
+    check(waitFor(normalResult.called) && normalResult.status == TS_OK_SUCCESS && !normalResult.onMainThread && normalResult.futureReady,
+          "callback runs on the worker after its request is done");
+    check(waitFor(chainedQueued) && chainedWrite.wait(10000) && chainedWrite.getStatus() == TS_OK_SUCCESS, "a callback can queue another request");
+    for(unsigned int i = 0; i < BULK_WRITES; i++)
+    {
+        normalWrites[i].wait(10000);
+    }
+
+    unsigned int dropped = 0;
+    unsigned int called = 0;
+    bool onWorker = true;
+    bool ready = true;
+    for(unsigned int i = 0; i < BULK_WRITES; i++)
+    {
+        if(!bulkResults[i].called.load())
+        {
+            continue;
+        }
+        called++;
+        dropped += (bulkResults[i].status == TS_ERR_RESULT_EXPIRED);
+        onWorker = onWorker && !bulkResults[i].onMainThread;
+        ready = ready && bulkResults[i].futureReady;
+    }
+    printf("%u of %u writes called back, %u of them dropped\n", called, BULK_WRITES, dropped);
+    check(dropped > 0, "newer requests dropped older ones");
+    check(onWorker, "every callback, including the -503 of a dropped request, ran on the worker thread");
+    check(ready, "every future was ready inside its callback");
+
+    // Every request critical and slow, so the last one finds no room and nothing it may drop
+    emulator.setLatency(4 * TS_WORKER_CRITICAL_WAIT_MS, 4 * TS_WORKER_CRITICAL_WAIT_MS);
+    ThingSpeakFuture critical[TS_WORKER_QUEUE_LENGTH + 1];
+    for(unsigned int i = 0; i < TS_WORKER_QUEUE_LENGTH; i++)
+    {
+        thingSpeak.setPriority(TS_PRIORITY_CRITICAL);
+        critical[i] = thingSpeak.writeRawAsync(CHANNEL_NUMBER, "field1=5", WRITE_API_KEY);
+    }
+    unsigned long startedAt = millis();
+    thingSpeak.setPriority(TS_PRIORITY_CRITICAL);
+    critical[TS_WORKER_QUEUE_LENGTH] = thingSpeak.writeRawAsync(CHANNEL_NUMBER, "field1=6", WRITE_API_KEY);
+    unsigned long waited = millis() - startedAt;
+    printf("critical request waited %lu ms for room\n", waited);
+    check(critical[TS_WORKER_QUEUE_LENGTH].getStatus() == TS_ERR_QUEUE_FULL && waited >= TS_WORKER_CRITICAL_WAIT_MS && waited < 2 * TS_WORKER_CRITICAL_WAIT_MS,
+          "a critical request with no room returns -501 after TS_WORKER_CRITICAL_WAIT_MS");
+
+    // The worker thread still runs, so leave without destroying the objects it uses
+    fflush(stdout);
+    _Exit((failures == 0) ? 0 : 1);
+}
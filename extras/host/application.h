@@ -0,0 +1,399 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  Host stand-in for the parts of the Device OS API the library uses, so the library, its tests and the emulator
+  can be built and run on Linux with g++.  Only what ThingSpeak.h and ThingSpeakEmulator.h call is provided, with
+  the same names and signatures as Device OS.  Build with -DPLATFORM_ID=12 and -I for this directory and src.
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#ifndef ThingSpeakHostApplication_h
+    #define ThingSpeakHostApplication_h
+
+    #include <string>
+    #include <deque>
+    #include <cstring>
+    #include <cstdio>
+    #include <cstdlib>
+    #include <cstdint>
+    #include <cctype>
+    #include <cmath>
+    #include <ctime>
+    #include <chrono>
+    #include <thread>
+    #include <atomic>
+    #include <mutex>
+    #include <condition_variable>
+
+    typedef uint8_t byte;
+    typedef uint32_t system_tick_t;
+    typedef uint8_t network_interface_t;
+
+    #define retained
+
+    inline system_tick_t millis()
+    {
+        static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        return (system_tick_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    inline void delay(unsigned long ms)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+
+    inline long random(long howBig)
+    {
+        return (howBig > 0) ? rand() % howBig : 0;
+    }
+
+    inline long random(long howSmall, long howBig)
+    {
+        return (howBig > howSmall) ? howSmall + rand() % (howBig - howSmall) : howSmall;
+    }
+
+    inline char * ltoa(long value, char * buffer, int radix)
+    {
+        (void)radix;
+        sprintf(buffer, "%ld", value);
+        return buffer;
+    }
+
+
+    // The subset of the Wiring String used by the library, backed by std::string
+    class String
+    {
+      public:
+        String() {}
+        String(const char * text) { if(NULL != text) this->text = text; }
+        String(const std::string & text) : text(text) {}
+        explicit String(char c) : text(1, c) {}
+        String(int value) : text(std::to_string(value)) {}
+        String(unsigned int value) : text(std::to_string(value)) {}
+        String(long value) : text(std::to_string(value)) {}
+        String(unsigned long value) : text(std::to_string(value)) {}
+        String(float value, int decimals = 2) { format(value, decimals); }
+        String(double value, int decimals = 2) { format(value, decimals); }
+
+        unsigned int length() const { return this->text.size(); }
+        const char * c_str() const { return this->text.c_str(); }
+        char charAt(unsigned int index) const { return (index < this->text.size()) ? this->text[index] : 0; }
+        char operator[](unsigned int index) const { return charAt(index); }
+        void setCharAt(unsigned int index, char c) { if(index < this->text.size()) this->text[index] = c; }
+        bool reserve(unsigned int size) { this->text.reserve(size); return true; }
+
+        int indexOf(char c, unsigned int from = 0) const { return position(this->text.find(c, from)); }
+        int indexOf(const String & s, unsigned int from = 0) const { return position(this->text.find(s.text, from)); }
+        int lastIndexOf(char c) const { return position(this->text.rfind(c)); }
+        bool startsWith(const String & s) const { return this->text.compare(0, s.text.size(), s.text) == 0; }
+        bool endsWith(const String & s) const { return this->text.size() >= s.text.size() && this->text.compare(this->text.size() - s.text.size(), s.text.size(), s.text) == 0; }
+        bool equals(const String & s) const { return this->text == s.text; }
+
+        String substring(unsigned int from) const { return (from >= this->text.size()) ? String() : String(this->text.substr(from)); }
+        String substring(unsigned int from, unsigned int to) const
+        {
+            if(from > to) std::swap(from, to);
+            return (from >= this->text.size()) ? String() : String(this->text.substr(from, to - from));
+        }
+        String & remove(unsigned int index) { if(index < this->text.size()) this->text.erase(index); return *this; }
+        String & remove(unsigned int index, unsigned int count) { if(index < this->text.size()) this->text.erase(index, count); return *this; }
+        void toLowerCase() { for(char & c : this->text) c = (char)tolower((unsigned char)c); }
+        void trim()
+        {
+            size_t first = this->text.find_first_not_of(" \t\r\n");
+            if(first == std::string::npos) { this->text.clear(); return; }
+            this->text = this->text.substr(first, this->text.find_last_not_of(" \t\r\n") - first + 1);
+        }
+        long toInt() const { return atol(this->text.c_str()); }
+        float toFloat() const { return (float)atof(this->text.c_str()); }
+        void toCharArray(char * buffer, unsigned int size) const
+        {
+            if(0 == size) return;
+            strncpy(buffer, this->text.c_str(), size);
+            buffer[size - 1] = '\0';
+        }
+        void getBytes(unsigned char * buffer, unsigned int size) const { toCharArray((char *)buffer, size); }
+
+        bool concat(const String & s) { this->text += s.text; return true; }
+        bool concat(const char * s) { this->text += s; return true; }
+        bool concat(char c) { this->text += c; return true; }
+        String & operator+=(const String & s) { this->text += s.text; return *this; }
+        String & operator+=(const char * s) { this->text += s; return *this; }
+        String & operator+=(char c) { this->text += c; return *this; }
+        bool operator==(const String & s) const { return this->text == s.text; }
+        bool operator==(const char * s) const { return this->text == s; }
+        bool operator!=(const String & s) const { return this->text != s.text; }
+        bool operator!=(const char * s) const { return this->text != s; }
+
+        friend String operator+(const String & a, const String & b) { return String(a.text + b.text); }
+        friend String operator+(const String & a, const char * b) { return String(a.text + b); }
+        friend String operator+(const char * a, const String & b) { return String(std::string(a) + b.text); }
+
+      private:
+        static int position(size_t found) { return (found == std::string::npos) ? -1 : (int)found; }
+        void format(double value, int decimals)
+        {
+            char buffer[64];
+            snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+            this->text = buffer;
+        }
+
+        std::string text;
+    };
+
+
+    class Print
+    {
+      public:
+        virtual ~Print() {}
+        virtual size_t write(uint8_t c) = 0;
+        virtual size_t write(const uint8_t * buffer, size_t size)
+        {
+            size_t written = 0;
+            while(size-- > 0) written += write(*buffer++);
+            return written;
+        }
+        size_t write(const char * text) { return write((const uint8_t *)text, strlen(text)); }
+
+        size_t print(const char * text) { return write(text); }
+        size_t print(const String & text) { return write((const uint8_t *)text.c_str(), text.length()); }
+        size_t print(char c) { return write((uint8_t)c); }
+        size_t print(int value) { return print(String(value)); }
+        size_t print(unsigned int value) { return print(String(value)); }
+        size_t print(long value) { return print(String(value)); }
+        size_t print(unsigned long value) { return print(String(value)); }
+        size_t print(double value, int decimals = 2) { return print(String(value, decimals)); }
+        size_t println() { return print("\r\n"); }
+        template <class T> size_t println(T value) { return print(value) + println(); }
+    };
+
+
+    class Stream : public Print
+    {
+      public:
+        virtual int available() = 0;
+        virtual int read() = 0;
+        virtual int peek() = 0;
+        virtual void flush() = 0;
+
+        void setTimeout(system_tick_t timeout) { this->timeout = timeout; }
+
+        bool find(const char * target)
+        {
+            size_t length = strlen(target);
+            size_t matched = 0;
+            int c;
+            while((c = timedRead()) >= 0)
+            {
+                if(c == target[matched])
+                {
+                    if(++matched == length) return true;
+                }
+                else
+                {
+                    matched = (c == target[0]) ? 1 : 0;
+                }
+            }
+            return false;
+        }
+        bool find(char * target) { return find((const char *)target); }
+
+        long parseInt()
+        {
+            int c;
+            while((c = timedPeek()) >= 0 && c != '-' && (c < '0' || c > '9'))
+            {
+                read();
+            }
+            if(c < 0) return 0;
+            bool negative = (c == '-');
+            if(negative) read();
+            long value = 0;
+            while((c = timedPeek()) >= '0' && c <= '9')
+            {
+                value = value * 10 + (c - '0');
+                read();
+            }
+            return negative ? -value : value;
+        }
+
+        String readString()
+        {
+            std::string text;
+            int c;
+            while((c = timedRead()) >= 0) text += (char)c;
+            return String(text);
+        }
+
+        String readStringUntil(char terminator)
+        {
+            std::string text;
+            int c;
+            while((c = timedRead()) >= 0 && c != terminator) text += (char)c;
+            return String(text);
+        }
+
+      protected:
+        int timedRead()
+        {
+            system_tick_t start = millis();
+            do
+            {
+                int c = read();
+                if(c >= 0) return c;
+                std::this_thread::yield();
+            } while(millis() - start < this->timeout);
+            return -1;
+        }
+
+        int timedPeek()
+        {
+            system_tick_t start = millis();
+            do
+            {
+                int c = peek();
+                if(c >= 0) return c;
+                std::this_thread::yield();
+            } while(millis() - start < this->timeout);
+            return -1;
+        }
+
+        system_tick_t timeout = 1000;
+    };
+
+
+    class IPAddress
+    {
+      public:
+        IPAddress() { memset(this->octets, 0, sizeof(this->octets)); }
+        IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) { this->octets[0] = a; this->octets[1] = b; this->octets[2] = c; this->octets[3] = d; }
+        operator bool() const { return 0 != (this->octets[0] | this->octets[1] | this->octets[2] | this->octets[3]); }
+        uint8_t operator[](int index) const { return this->octets[index]; }
+
+      private:
+        uint8_t octets[4];
+    };
+
+
+    class Client : public Stream
+    {
+      public:
+        virtual int connect(IPAddress ip, uint16_t port, network_interface_t nif = 0) = 0;
+        virtual int connect(const char * host, uint16_t port, network_interface_t nif = 0) = 0;
+        virtual int read(uint8_t * buffer, size_t size) = 0;
+        virtual void stop() = 0;
+        virtual uint8_t connected() = 0;
+        virtual operator bool() = 0;
+        using Stream::read;
+    };
+
+
+    // Time.now() is the host clock, unless a test sets a fixed time or makes the time unknown
+    class TimeClass
+    {
+      public:
+        bool isValid() { return this->valid; }
+        time_t now() { return (this->fixed != 0) ? this->fixed : ::time(NULL); }
+        void setValid(bool valid) { this->valid = valid; }
+        void setFixed(time_t fixed) { this->fixed = fixed; }
+
+      private:
+        bool valid = true;
+        time_t fixed = 0;
+    };
+    __attribute__((unused)) static TimeClass Time;
+
+
+    // Threading, the same calls as the Device OS concurrency HAL and wiring
+    #define PLATFORM_THREADING 1
+    #define OS_THREAD_PRIORITY_DEFAULT     2
+    #define OS_THREAD_STACK_SIZE_DEFAULT   3072
+    #define CONCURRENT_WAIT_FOREVER        ((system_tick_t)-1)
+
+    typedef void (*os_thread_fn_t)(void * param);
+    typedef uint8_t os_thread_prio_t;
+
+    typedef struct os_queue_record
+    {
+        std::mutex lock;
+        std::condition_variable changed;
+        std::deque<std::string> items;
+        size_t itemSize;
+        size_t length;
+    }* os_queue_t;
+
+    inline int os_queue_create(os_queue_t * queue, size_t itemSize, size_t length, void *)
+    {
+        *queue = new os_queue_record();
+        (*queue)->itemSize = itemSize;
+        (*queue)->length = length;
+        return 0;
+    }
+
+    inline int os_queue_put(os_queue_t queue, const void * item, system_tick_t, void *)
+    {
+        std::lock_guard<std::mutex> lock(queue->lock);
+        if(queue->items.size() >= queue->length) return 1;
+        queue->items.push_back(std::string((const char *)item, queue->itemSize));
+        queue->changed.notify_one();
+        return 0;
+    }
+
+    inline int os_queue_take(os_queue_t queue, void * item, system_tick_t delay, void *)
+    {
+        std::unique_lock<std::mutex> lock(queue->lock);
+        if(delay == CONCURRENT_WAIT_FOREVER)
+        {
+            queue->changed.wait(lock, [queue]{ return !queue->items.empty(); });
+        }
+        else if(!queue->changed.wait_for(lock, std::chrono::milliseconds(delay), [queue]{ return !queue->items.empty(); }))
+        {
+            return 1;
+        }
+        memcpy(item, queue->items.front().data(), queue->itemSize);
+        queue->items.pop_front();
+        return 0;
+    }
+
+    inline int os_queue_destroy(os_queue_t queue, void *)
+    {
+        delete queue;
+        return 0;
+    }
+
+    class Thread
+    {
+      public:
+        Thread(const char *, os_thread_fn_t function, void * param, os_thread_prio_t = OS_THREAD_PRIORITY_DEFAULT, size_t = OS_THREAD_STACK_SIZE_DEFAULT)
+        {
+            std::thread(function, param).detach();
+        }
+        bool isValid() const { return true; }
+    };
+
+    class Mutex
+    {
+      public:
+        void lock() { this->mutex.lock(); }
+        void unlock() { this->mutex.unlock(); }
+        bool trylock() { return this->mutex.try_lock(); }
+
+      private:
+        std::mutex mutex;
+    };
+
+    class RecursiveMutex
+    {
+      public:
+        void lock() { this->mutex.lock(); }
+        void unlock() { this->mutex.unlock(); }
+        bool trylock() { return this->mutex.try_lock(); }
+
+      private:
+        std::recursive_mutex mutex;
+    };
+
+#endif //ThingSpeakHostApplication_h
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""Writes InflateFixtures.h, the gzip streams InflateTest.cpp decodes.
+
+The streams are recorded once and checked in, so the test does not depend on the zlib that made them.
+Run from extras/host after changing this script:  python3 make_inflate_fixtures.py > InflateFixtures.h
+"""
+
+import random
+import zlib
+
+
+def feed_text():
+    # A short feeds.json, shaped like a ThingSpeak history read
+    rng = random.Random(35)
+    entries = []
+    for entry_id in range(1, 41):
+        entries.append('{"created_at":"2025-03-01T%02d:%02d:00Z","entry_id":%d,"field1":"%.2f","field2":"%d"}'
+                       % (entry_id // 60, entry_id % 60, entry_id, 18 + rng.random() * 6, rng.randint(30, 70)))
+    return ('{"channel":{"id":1234567,"name":"Weather station","latitude":"0.0","longitude":"0.0","field1":"Temperature",'
+            '"field2":"Humidity","created_at":"2025-01-01T00:00:00Z","updated_at":"2025-01-01T00:00:00Z","last_entry_id":40},'
+            '"feeds":[' + ','.join(entries) + ']}')
+
+
+def far_reference_text():
+    # The same 1 KB of text before and after 20 KB of filler, so the second copy refers back 21 KB
+    rng = random.Random(350)
+    block = ''.join(rng.choice('abcdefghijklmnopqrstuvwxyz0123456789') for _ in range(1024))
+    return block + 'x' * 20000 + block
+
+
+def gzip(data, level=9, strategy=zlib.Z_DEFAULT_STRATEGY):
+    # wbits 31 writes a gzip header with a zero modification time, so the output is the same on every run
+    compressor = zlib.compressobj(level, zlib.DEFLATED, 31, 9, strategy)
+    return compressor.compress(data) + compressor.flush()
+
+
+def block_type(stream):
+    # The first block starts right after the 10 byte header, BFINAL is bit 0 and BTYPE bits 1-2
+    return (stream[10] >> 1) & 3
+
+
+def chunked_response(body):
+    # An HTTP response with the body split into uneven chunks, the way a server streams it
+    sizes = [1, 7, 64, 300]
+    chunks = []
+    position = 0
+    index = 0
+    while position < len(body):
+        size = sizes[index % len(sizes)]
+        chunks.append(b'%x\r\n' % len(body[position:position + size]) + body[position:position + size] + b'\r\n')
+        position += size
+        index += 1
+    headers = (b'HTTP/1.1 200 OK\r\nContent-Type: application/json; charset=utf-8\r\nContent-Encoding: gzip\r\n'
+               b'Transfer-Encoding: chunked\r\nConnection: close\r\n\r\n')
+    return headers + b''.join(chunks) + b'0\r\n\r\n'
+
+
+def c_array(name, data, comment):
+    lines = ['    // ' + comment, '    static const uint8_t %s[] = {' % name]
+    for start in range(0, len(data), 16):
+        lines.append('        ' + ', '.join('0x%02x' % b for b in data[start:start + 16]) + ',')
+    lines.append('    };')
+    return '\n'.join(lines)
+
+
+def c_string(name, text, comment):
+    lines = ['    // ' + comment, '    static const char %s[] =' % name]
+    for start in range(0, len(text), 100):
+        lines.append('        "%s"' % text[start:start + 100].replace('\\', '\\\\').replace('"', '\\"'))
+    lines[-1] += ';'
+    return '\n'.join(lines)
+
+
+def main():
+    feed = feed_text().encode()
+    far = far_reference_text().encode()
+
+    stored = gzip(feed, level=0)
+    fixed = gzip(feed, strategy=zlib.Z_FIXED)
+    dynamic = gzip(feed)
+    assert (block_type(stored), block_type(fixed), block_type(dynamic)) == (0, 1, 2)
+    corrupt = bytearray(dynamic)
+    corrupt[-8] ^= 0x01
+    far_stream = gzip(far)
+    assert zlib.decompress(far_stream, 31) == far
+
+    parts = [
+        '/*',
+        '  ThingSpeak(TM) Communication Library For Particle',
+        '',
+        '  gzip streams decoded by InflateTest.cpp, written by make_inflate_fixtures.py.  Do not edit.',
+        '',
+        '  Copyright 2020-2025, The MathWorks, Inc.',
+        '',
+        '  See the accompanying license file for licensing information.',
+        '*/',
+        '',
+        '#ifndef InflateFixtures_h',
+        '    #define InflateFixtures_h',
+        '',
+        '    #include <stdint.h>',
+        '',
+        c_string('inflateFeedText', feed.decode(), 'The text the feed streams decode to'),
+        '',
+        c_array('inflateStored', stored, 'The feed in stored blocks, compression level 0'),
+        '',
+        c_array('inflateFixed', fixed, 'The feed in fixed Huffman blocks'),
+        '',
+        c_array('inflateDynamic', dynamic, 'The feed in dynamic Huffman blocks'),
+        '',
+        c_array('inflateCorruptCRC', bytes(corrupt), 'inflateDynamic with one bit of the CRC-32 in the trailer flipped'),
+        '',
+        c_array('inflateChunkedResponse', chunked_response(dynamic), 'An HTTP response carrying inflateDynamic in chunks of 1, 7, 64 and 300 bytes'),
+        '',
+        '    #define INFLATE_FAR_LENGTH         %d      // Length of the text inflateFarReference decodes to' % len(far),
+        '    #define INFLATE_FAR_DISTANCE       %d      // Distance of its back reference' % (len(far) - 1024),
+        '',
+        c_array('inflateFarReference', far_stream, '1 KB of text, 20 KB of filler and the same 1 KB again, which needs a window over 16 KB'),
+        '',
+        '#endif //InflateFixtures_h',
+    ]
+    print('\n'.join(parts))
+
+
+if __name__ == '__main__':
+    main()
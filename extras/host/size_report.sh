@@ -0,0 +1,81 @@
+#!/bin/sh
+# Reports what the library costs a sketch that writes two integer fields, for each combination of the
+# TS_DISABLE_* defines in the README table.
+#
+# Run from the root of the library:
+#   sh extras/host/size_report.sh              host build with g++, sizes of SizeSketch.cpp
+#   sh extras/host/size_report.sh argon        device build with the Particle CLI (logged in), for any platform name
+#                                              that "particle compile" takes
+#
+# The host build links with --gc-sections and subtracts a build of the sketch without the library, so the figures
+# are code and static RAM the library adds.  The device build prints the memory use "particle compile" reports
+# for each combination; subtract the figures of an empty sketch for the cost of the library.
+
+set -e
+
+COMBINATIONS="none
+TS_DISABLE_READS
+TS_DISABLE_FLOAT
+TS_DISABLE_LOCATION
+TS_DISABLE_STATUS
+TS_DISABLE_READS TS_DISABLE_FLOAT TS_DISABLE_STATUS"
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+flags()
+{
+    for define in $1; do
+        [ "$define" = none ] || printf ' -D%s' "$define"
+    done
+}
+
+host_size()
+{
+    # text, then data + bss
+    g++ -std=gnu++14 -Os -ffunction-sections -fdata-sections -Wl,--gc-sections -DPLATFORM_ID=12 -Iextras/host -Isrc \
+        "$@" extras/host/SizeSketch.cpp -o "$WORK/sketch" -pthread
+    size "$WORK/sketch" | awk 'NR == 2 { print $1, $2 + $3 }'
+}
+
+if [ $# -eq 0 ]; then
+    set -- $(host_size -DSIZE_BASELINE)
+    BASE_FLASH=$1
+    BASE_RAM=$2
+    printf '%-60s %8s %8s\n' "Define(s)" "Flash" "RAM"
+    echo "$COMBINATIONS" | while read -r combination; do
+        set -- $(host_size $(flags "$combination"))
+        printf '%-60s %8d %8d\n' "$combination" $(($1 - BASE_FLASH)) $(($2 - BASE_RAM))
+    done
+    exit 0
+fi
+
+PLATFORM=$1
+echo "$COMBINATIONS" | while read -r combination; do
+    rm -rf "$WORK/project"
+    mkdir -p "$WORK/project/src"
+    cp src/*.h src/ThingSpeak.cpp "$WORK/project/src/"
+    # The defines go at the top of ThingSpeak.h, where the README says to put them
+    for define in $combination; do
+        [ "$define" = none ] || printf '#define %s\n' "$define"
+    done > "$WORK/project/src/ThingSpeak.h"
+    cat src/ThingSpeak.h >> "$WORK/project/src/ThingSpeak.h"
+    cat > "$WORK/project/src/SizeSketch.ino" <<'SKETCH'
+#include "ThingSpeak.h"
+
+TCPClient client;
+
+void setup() {
+  ThingSpeak.begin(client);
+}
+
+void loop() {
+  ThingSpeak.setField(1, (long)analogRead(A0));
+  ThingSpeak.setField(2, (long)millis());
+  ThingSpeak.writeFields(31461, "LD79EOAAWRVYF04Y");
+  delay(20000);
+}
+SKETCH
+    echo "== $combination"
+    particle compile "$PLATFORM" "$WORK/project" --saveTo "$WORK/firmware.bin" | sed -n '/Memory use/,$p'
+done
@@ -0,0 +1,3 @@
+/*
+  Host stand-in for the Device OS string_convert.h, ltoa() is declared in application.h
+*/
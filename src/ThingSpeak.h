@@ -11,8 +11,14 @@
   See the accompanying license file for licensing information.
 */
 
-//#define PRINT_DEBUG_MESSAGES
-//#define PRINT_HTTP
+//#define TS_LOG_LEVEL TS_LOG_LEVEL_TRACE
+//#define TS_COMPACT_STORAGE
+//#define TS_GZIP_RESPONSES
+//#define TS_WARM_START
+//#define TS_DISABLE_READS
+//#define TS_DISABLE_FLOAT
+//#define TS_DISABLE_LOCATION
+//#define TS_DISABLE_STATUS
  
 #ifndef ThingSpeak_h
     #define ThingSpeak_h
@@ -45,8 +51,23 @@
     #endif
 
 
+    // Location is written with float formatting, so it is left out with it
+    #if defined(TS_DISABLE_FLOAT) && !defined(TS_DISABLE_LOCATION)
+        #define TS_DISABLE_LOCATION
+    #endif
+
+
     #include "math.h"
     #include "application.h"
+    #include <atomic>
+    #if PLATFORM_THREADING
+        #include <mutex>
+    #endif
+    #include "ThingSpeakLog.h"
+    #ifdef TS_GZIP_RESPONSES
+        #include <new>
+        #include "ThingSpeakInflate.h"
+    #endif
     #ifdef PARTICLE_PHOTONELECTRON
         extern char* dtoa(double val, unsigned char prec, char *sout);
         // On spark photon, There is no itoa, so map to ltoa.
@@ -79,8 +100,6 @@
     #else
         #define TS_USER_AGENT "tslib-arduino/" TS_VER " (particle unknown)"
     #endif
-    #define SPARK_PUBLISH_TTL 60 // Spark "time to live" for published messages
-    #define SPARK_PUBLISH_TOPIC "thingspeak-debug"
 
 
     #define FIELDNUM_MIN 1
@@ -88,1407 +107,6334 @@
     #define FIELDLENGTH_MAX 255  // Max length for a field in ThingSpeak is 255 bytes (UTF-8)
 
     #define TIMEOUT_MS_SERVERRESPONSE 5000  // Wait up to five seconds for server to respond
+    #define TS_STREAM_TIMEOUT_MS      1000  // Stream timeout of the client for each find() or read, the Particle default
+    #ifndef TS_PREPARE_IDLE_MS
+        #define TS_PREPARE_IDLE_MS    10000 // A connection opened by prepare() and not used for this long is closed
+    #endif
 
     #define TS_OK_SUCCESS              200     // OK / Success
+    #define TS_OK_SENT                 202     // Write sent without waiting for the response, see setFireAndForget()
+    #define TS_OK_NOT_MODIFIED         304     // poll() found no new entry
     #define TS_ERR_BADAPIKEY           400     // Incorrect API key (or invalid ThingSpeak server address)
     #define TS_ERR_BADURL              404     // Incorrect API key (or invalid ThingSpeak server address)
-    #define TS_ERR_OUT_OF_RANGE        -101    // Value is out of range or string is too long (> 255 bytes)
+    #define TS_ERR_OUT_OF_RANGE        -101    // Value is out of range, NULL, or string is too long (> 255 bytes)
     #define TS_ERR_INVALID_FIELD_NUM   -201    // Invalid field number specified
     #define TS_ERR_SETFIELD_NOT_CALLED -210    // setField() was not called before writeFields()
+    #define TS_ERR_TIME_UNKNOWN        -211    // setCreatedAtNow() was called before the time was known
     #define TS_ERR_CONNECT_FAILED      -301    // Failed to connect to ThingSpeak
     #define TS_ERR_UNEXPECTED_FAIL     -302    // Unexpected failure during write to ThingSpeak
     #define TS_ERR_BAD_RESPONSE        -303    // Unable to parse response
     #define TS_ERR_TIMEOUT             -304    // Timeout waiting for server to respond
+    #define TS_ERR_CIRCUIT_OPEN        -305    // Not sent, ThingSpeak has been unreachable and the circuit breaker is open
+    #define TS_ERR_DEADLINE_EXCEEDED   -306    // The deadline or time budget of the call passed before it finished
+    #define TS_ERR_OUT_OF_MEMORY       -307    // Not enough free heap to decode a compressed response
     #define TS_ERR_NOT_INSERTED        -401    // Point was not inserted (most probable cause is the rate limit of once every 15 seconds)
+    #define TS_ERR_RATE_LIMITED        -402    // Not sent, the channel was updated less than its minimum interval ago
+    #define TS_ERR_BUDGET_EXCEEDED     -403    // Not sent, the data budget governor is holding back this request
+    #define TS_ERR_SHARDS_MISMATCH     -404    // No recent entry of a virtual channel was found in all of its shards
+    #define TS_ERR_UNCONFIRMED         -405    // confirmDelivery() found a newer entry that could not be matched to the pending update
+    #define TS_ERR_QUEUE_FULL          -501    // The staging queue is full, the value was dropped
+    #define TS_ERR_NOT_READY           -502    // The worker thread has not finished the call yet
+    #define TS_ERR_RESULT_EXPIRED      -503    // The result was discarded to make room for newer worker requests
 
-    
-    // variables to store the values from the readMultipleFields functionality
-    typedef struct feedRecord
-    {
-        String nextReadField[8];
-        String nextReadStatus;
-        String nextReadLatitude;
-        String nextReadLongitude;
-        String nextReadElevation;
-        String nextReadCreatedAt;
-    }feed;
+    // Selection masks for readSelectedFields()
+    #define TS_SELECT_FIELD(field)     (1u << ((field) - 1))  // Select a single field (1-8)
+    #define TS_SELECT_ALL_FIELDS       0x00FFu                // Select fields 1 through 8
+    #define TS_SELECT_STATUS           0x0100u                // Select the status message
+    #define TS_SELECT_LOCATION         0x0E00u                // Select latitude, longitude and elevation
+    #define TS_SELECT_CREATED_AT       0x1000u                // Always included except for a single field
+    #define TS_FEED_ALL_VALUES         0x1FFFu
+
+    // Server-side aggregations for ThingSpeakQuery
+    #define TS_AGGREGATE_NONE          0
+    #define TS_AGGREGATE_TIMESCALE     1       // First value of each period
+    #define TS_AGGREGATE_AVERAGE       2       // Average of each period
+    #define TS_AGGREGATE_MEDIAN        3       // Median of each period
+    #define TS_AGGREGATE_SUM           4       // Sum of each period
+
+    // Aggregation periods supported by ThingSpeak, in minutes
+    #define TS_PERIOD_10_MINUTES       10
+    #define TS_PERIOD_15_MINUTES       15
+    #define TS_PERIOD_20_MINUTES       20
+    #define TS_PERIOD_30_MINUTES       30
+    #define TS_PERIOD_HOURLY           60
+    #define TS_PERIOD_4_HOURS          240
+    #define TS_PERIOD_12_HOURS         720
+    #define TS_PERIOD_24_HOURS         1440
+    #define TS_PERIOD_DAILY            0xFFFF  // Calendar day in the channel's time zone
+
+    // Reductions that combine several values into one
+    #define TS_REDUCE_MEAN             0
+    #define TS_REDUCE_MIN              1
+    #define TS_REDUCE_MAX              2
+    #define TS_REDUCE_SUM              3
+    #define TS_REDUCE_LAST             4
+    #define TS_REDUCE_MINMAX_STATUS    5       // Mean in the field, minimum and maximum appended to the status (addSample() only)
+
+    #define TS_QUERY_RESULTS_MAX       8000    // ThingSpeak returns at most 8000 entries per request
+    #define TS_STATISTIC_PERIODS_MAX   16      // Periods combined by readAggregatedStatistic()
 
     
-    // Enables Particle hardware to write or read data to or from ThingSpeak, an open data platform for the Internet of Things with MATLAB analytics and visualization.
-    class ThingSpeakClass
+    // Capacities of the inline value slots used when TS_COMPACT_STORAGE is defined
+    #ifndef TS_COMPACT_FIELD_LENGTH
+        #define TS_COMPACT_FIELD_LENGTH     32  // Fits any value written by setField(long) or setField(float)
+    #endif
+    #ifndef TS_COMPACT_STATUS_LENGTH
+        #define TS_COMPACT_STATUS_LENGTH    64
+    #endif
+    #ifndef TS_COMPACT_TIMESTAMP_LENGTH
+        #define TS_COMPACT_TIMESTAMP_LENGTH 32  // Fits "2017-01-12T13:22:54+00:00"
+    #endif
+    #ifndef TS_COMPACT_FEED_LENGTH
+        #define TS_COMPACT_FEED_LENGTH      512 // Fits the last feed of a channel with 8 short fields, status and location
+    #endif
+
+
+    // Fixed-capacity string stored inline, used in place of String when TS_COMPACT_STORAGE is defined
+    template <unsigned int CAPACITY>
+    class ThingSpeakSlot
     {
       public:
-        ThingSpeakClass()
+        ThingSpeakSlot()
         {
-            resetWriteFields();
-            this->lastReadStatus = TS_OK_SUCCESS;
-        };
-
-        /*
-        Function: begin
-        
-        Summary:
-        Initializes the ThingSpeak library and network settings using the ThingSpeak.com service.
-        
-        Parameters:
-        client - TCPClient created earlier in the sketch
-        
-        Returns:
-        Always returns true
+            this->value[0] = '\0';
+            this->used = 0;
+        }
         
-        Notes:
-        This does not validate the information passed in, or generate any calls to ThingSpeak.
-        */
-        bool begin(Client & client)
+        ThingSpeakSlot & operator=(const char * text)
         {
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, "ts::tsBegin", SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
-            this->setClient(&client);
-            this->setPort(THINGSPEAK_PORT_NUMBER);
-            resetWriteFields();
-            this->lastReadStatus = TS_OK_SUCCESS;
-            return true;
+            assign(text, (NULL == text) ? 0 : strlen(text));
+            return *this;
         }
         
-        
-        /*
-        Function: writeField
-        
-        Summary:
-        Write an integer value to a single field in a ThingSpeak channel
-        
-        Parameters:
-        channelNumber - Channel number
-        field - Field number (1-8) within the channel to write to.
-        value - Integer value (from -32,768 to 32,767) to write.
-        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
-        
-        Returns:
-        HTTP status code of 200 if successful.
-        
-        Notes:
-        See getLastReadStatus() for other possible return values.
-        */
-        int writeField(unsigned long channelNumber, unsigned int field, int value, const char * writeAPIKey)
+        ThingSpeakSlot & operator=(const String & text)
         {
-            // On Spark, int and long are the same, so map to the long version
-            return writeField(channelNumber, field, (long)value, writeAPIKey);
+            assign(text.c_str(), text.length());
+            return *this;
         }
         
-
-        /*
-        Function: writeField
-        
-        Summary:
-        Write a long value to a single field in a ThingSpeak channel
-        
-        Parameters:
-        channelNumber - Channel number
-        field - Field number (1-8) within the channel to write to.
-        value - Long value (from -2,147,483,648 to 2,147,483,647) to write.
-        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
-        
-        Returns:
-        HTTP status code of 200 if successful.
-        
-        Notes:
-        See getLastReadStatus() for other possible return values.
-        */
-        int writeField(unsigned long channelNumber, unsigned int field, long value, const char * writeAPIKey)
+        void setCharAt(unsigned int index, char ch)
         {
-            char valueString[15];  // long range is -2147483648 to 2147483647, so 12 bytes including terminator
-            ltoa(value, valueString, 10);
-            return writeField(channelNumber, field, valueString, writeAPIKey);
+            if(index < this->used) this->value[index] = ch;
         }
-
         
-        /*
-        Function: writeField
+        operator String() const
+        {
+            return String(this->value);
+        }
         
-        Summary:
-        Write a floating point value to a single field in a ThingSpeak channel
+        unsigned int length() const
+        {
+            return this->used;
+        }
         
-        Parameters:
-        channelNumber - Channel number
-        field - Field number (1-8) within the channel to write to.
-        value - Floating point value (from -999999000000 to 999999000000) to write.  If you need more accuracy, or a wider range, you should format the number using <tt>dtostrf</tt> and writeField().
-        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        const char * c_str() const
+        {
+            return this->value;
+        }
         
-        Returns:
-        HTTP status code of 200 if successful.
+      private:
+        // Values longer than the capacity are truncated, the setters reject them before they get here
+        void assign(const char * text, size_t textLength)
+        {
+            if(textLength > CAPACITY) textLength = CAPACITY;
+            memcpy(this->value, text, textLength);
+            this->value[textLength] = '\0';
+            this->used = textLength;
+        }
         
-        Notes:
-        See getLastReadStatus() for other possible return values.
-        */
-        int writeField(unsigned long channelNumber, unsigned int field, float value, const char * writeAPIKey)
+        char value[CAPACITY + 1];
+        uint16_t used;
+    };
+
+
+    #ifdef TS_COMPACT_STORAGE
+        // Staged and last-read values live inline in ThingSpeakClass, so no heap is used for them
+        typedef ThingSpeakSlot<TS_COMPACT_FIELD_LENGTH> tsFieldValue;
+        typedef ThingSpeakSlot<TS_COMPACT_STATUS_LENGTH> tsStatusValue;
+        typedef ThingSpeakSlot<TS_COMPACT_TIMESTAMP_LENGTH> tsTimestampValue;
+        typedef ThingSpeakSlot<TS_COMPACT_FEED_LENGTH> tsFeedContent;
+        #define TS_FIELD_VALUE_MAX      TS_COMPACT_FIELD_LENGTH
+        #define TS_STATUS_VALUE_MAX     TS_COMPACT_STATUS_LENGTH
+        #define TS_TIMESTAMP_VALUE_MAX  TS_COMPACT_TIMESTAMP_LENGTH
+    #else
+        typedef String tsFieldValue;
+        typedef String tsStatusValue;
+        typedef String tsTimestampValue;
+        typedef String tsFeedContent;
+        #define TS_FIELD_VALUE_MAX      FIELDLENGTH_MAX
+        #define TS_STATUS_VALUE_MAX     FIELDLENGTH_MAX
+        #define TS_TIMESTAMP_VALUE_MAX  FIELDLENGTH_MAX
+    #endif
+
+    
+    // Types of value held by a stagedValueRecord
+    #define TS_VALUE_NONE              0       // setField() was not called
+    #define TS_VALUE_LONG              1
+    #define TS_VALUE_FLOAT             2
+    #define TS_VALUE_TEXT              3
+    #define TS_VALUE_SAMPLES           4       // Running statistics from addSample()
+
+    
+    // A value set by setField(), kept in binary and only formatted while the update is sent
+    typedef struct stagedValueRecord
+    {
+        uint8_t type;
+        union
         {
-            #ifdef PRINT_DEBUG_MESSAGES
-            Particle.publish(SPARK_PUBLISH_TOPIC, "ts::writeField (channelNumber: " + String(channelNumber) + " writeAPIKey: " + String(writeAPIKey) + " field: " + String(field) + " value: " + String(value,5) + ")" , SPARK_PUBLISH_TTL, PRIVATE);
+            long longValue;
+            #ifndef TS_DISABLE_FLOAT
+            float floatValue;
+            struct
+            {
+                double sum;
+                float minimum;
+                float maximum;
+                float last;
+                unsigned long count;
+            }samples;
             #endif
-            char valueString[20]; // range is -999999000000.00000 to 999999000000.00000, so 19 + 1 for the terminator
-            int status = convertFloatToChar(value, valueString);
-            if(status != TS_OK_SUCCESS) return status;
+        };
+        tsFieldValue text;     // Only used by TS_VALUE_TEXT
+    }stagedValue;
 
-            return writeField(channelNumber, field, valueString, writeAPIKey);
-        }
-        
 
-        /*
-        Function: writeField
-        
-        Summary:
-        Write a string to a single field in a ThingSpeak channel
-        
-        Parameters:
-        channelNumber - Channel number
-        field - Field number (1-8) within the channel to write to.
-        value - String to write (UTF8 string).  ThingSpeak limits this field to 255 bytes.
-        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
-        
-        Returns:
-        HTTP status code of 200 if successful.
-        
-        Notes:
-        See getLastReadStatus() for other possible return values.
-        */
-        int writeField(unsigned long channelNumber, unsigned int field, String value, const char * writeAPIKey)
+    #ifndef TS_STAGING_QUEUE_LENGTH
+        #define TS_STAGING_QUEUE_LENGTH    16      // Values queued by queueField()/queueSample() between writes, must be a power of two
+    #endif
+
+
+    // A value queued by queueField() or queueSample(), applied to the staged values by the thread that writes
+    typedef struct queuedValueRecord
+    {
+        uint8_t field;
+        uint8_t type;          // TS_VALUE_LONG, TS_VALUE_FLOAT, or TS_VALUE_SAMPLES for addSample()
+        union
         {
-            // Invalid field number specified
-            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX) return TS_ERR_INVALID_FIELD_NUM;
-            // Max # bytes for ThingSpeak field is 255
-            if(value.length() > FIELDLENGTH_MAX) return TS_ERR_OUT_OF_RANGE;
-            
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, "writeField (" + String(channelNumber) + ", " + String(writeAPIKey) + ", " + String(field) + ", " + escapeUrl(value) + ")", SPARK_PUBLISH_TTL, PRIVATE);
+            long longValue;
+            #ifndef TS_DISABLE_FLOAT
+            float floatValue;
             #endif
-            String postMessage = String("field") + String(field) + "=" + escapeUrl(value);
-            return writeRaw(channelNumber, postMessage, writeAPIKey);
-        }
-        
+        };
+    }queuedValue;
 
-        /*
-        Function: setField
+
+    // Single-producer, single-consumer ring of queued values.  Neither side locks or allocates, so the producer may be an ISR or timer.
+    template <unsigned int LENGTH>
+    class ThingSpeakStagingQueue
+    {
+      public:
+        ThingSpeakStagingQueue()
+        {
+            static_assert(LENGTH > 0 && (LENGTH & (LENGTH - 1)) == 0, "TS_STAGING_QUEUE_LENGTH must be a power of two");
+            this->head.store(0);
+            this->tail.store(0);
+            this->dropped.store(0);
+        }
         
-        Summary:
-        Set the value of a single field that will be part of a multi-field update.
+        // Only called by the producer
+        bool push(const queuedValue & value)
+        {
+            unsigned int tail = this->tail.load(std::memory_order_relaxed);
+            if(tail - this->head.load(std::memory_order_acquire) >= LENGTH)
+            {
+                // Only the producer writes the count, so it does not need a read-modify-write
+                this->dropped.store(this->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return false;
+            }
+            this->entries[tail % LENGTH] = value;
+            this->tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
         
-        Parameters:
-        field - Field number (1-8) within the channel to set.
-        value - Integer value (from -32,768 to 32,767) to set.
+        // Only called by the consumer
+        bool pop(queuedValue & value)
+        {
+            unsigned int head = this->head.load(std::memory_order_relaxed);
+            if(head == this->tail.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            value = this->entries[head % LENGTH];
+            this->head.store(head + 1, std::memory_order_release);
+            return true;
+        }
         
-        Returns:
-        Code of 200 if successful.
-        Code of -101 if value is out of range or string is too long (> 255 bytes)
-        */
-        int setField(unsigned int field, int value)
+        unsigned long getDropped() const
         {
-            // On Spark, int and long are the same, so map to the long version
-            return setField(field, (long)value);
+            return this->dropped.load(std::memory_order_relaxed);
         }
         
+      private:
+        queuedValue entries[LENGTH];
+        std::atomic<unsigned int> head;    // Next entry to pop, written by the consumer
+        std::atomic<unsigned int> tail;    // Next entry to push, written by the producer
+        std::atomic<unsigned long> dropped;
+    };
 
-        /*
-        Function: setField
+
+    // Counts the bytes printed to it, used to send a Content-Length before the body is formatted
+    class ThingSpeakLengthCounter : public Print
+    {
+      public:
+        ThingSpeakLengthCounter()
+        {
+            this->count = 0;
+        }
         
-        Summary:
-        Set the value of a single field that will be part of a multi-field update.
+        virtual size_t write(uint8_t)
+        {
+            this->count++;
+            return 1;
+        }
         
-        Parameters:
-        field - Field number (1-8) within the channel to set.
-        value - Long value (from -2,147,483,648 to 2,147,483,647) to write.
+        virtual size_t write(const uint8_t *, size_t size)
+        {
+            this->count += size;
+            return size;
+        }
         
-        Returns:
-        Code of 200 if successful.
-        Code of -101 if value is out of range or string is too long (> 255 bytes)
-        */
-        int setField(unsigned int field, long value)
+        size_t length() const
         {
-            char valueString[15];  // long range is -2147483648 to 2147483647, so 12 bytes including terminator
-            ltoa(value, valueString, 10);
-            return setField(field, valueString);
+            return this->count;
         }
         
+      private:
+        size_t count;
+    };
 
-        /*
-        Function: setField
-        
-        Summary:
-        Set the value of a single field that will be part of a multi-field update.
+
+    // Appends what is printed to it to a String, used to copy the staged values and to collect decoded responses
+    class ThingSpeakStringPrinter : public Print
+    {
+      public:
+        ThingSpeakStringPrinter(String & target) : target(target)
+        {
+        }
         
-        Parameters:
-        field - Field number (1-8) within the channel to set.
-        value - Floating point value (from -999999000000 to 999999000000) to write.  If you need more accuracy, or a wider range, you should format the number yourself (using <tt>dtostrf</tt>) and setField() using the resulting string.
+        virtual size_t write(uint8_t c)
+        {
+            this->target += (char)c;
+            return 1;
+        }
         
-        Returns:
-        Code of 200 if successful.
-        Code of -101 if value is out of range or string is too long (> 255 bytes)
-        */
-        int setField(unsigned int field, float value)
+        virtual size_t write(const uint8_t * buffer, size_t size)
         {
-            char valueString[20]; // range is -999999000000.00000 to 999999000000.00000, so 19 + 1 for the terminator
-            int status = convertFloatToChar(value, valueString);
-            if(status != TS_OK_SUCCESS) return status;
-
-            return setField(field, valueString);
+            // Grow once per block instead of once per character
+            this->target.reserve(this->target.length() + size);
+            for(size_t i = 0; i < size; i++)
+            {
+                this->target += (char)buffer[i];
+            }
+            return size;
         }
         
+      private:
+        String & target;
+    };
 
-        /*
-        Function: setField
-        
-        Summary:
-        Set the value of a single field that will be part of a multi-field update.
-        
-        Parameters:
-        field - Field number (1-8) within the channel to set.
-        value - String to write (UTF8).  ThingSpeak limits this to 255 bytes.
+
+    // Response headers the library acts on
+    typedef struct responseHeadersRecord
+    {
+        bool gzip;             // Content-Encoding: gzip
+        bool chunked;          // Transfer-Encoding: chunked
+        long contentLength;    // -1 if not sent
+    }responseHeaders;
+
+
+    #define TS_ETAG_LENGTH             64      // Longest ETag kept by poll()
+
+    typedef void (*ThingSpeakChangeCallback)(unsigned long channelNumber, long entryID, void * context);
+
+    // What poll() has seen of a channel, set up by beginPoll()
+    typedef struct pollStateRecord
+    {
+        unsigned long channelNumber;
+        uint16_t selection;                    // TS_SELECT_* values to keep when the channel changes
+        const char * readAPIKey;               // Must stay valid while polling
+        long lastEntryID;
+        char etag[TS_ETAG_LENGTH + 1];         // Sent as If-None-Match, empty if the server did not send one
+        unsigned long probes;
+        unsigned long changes;
+    }pollState;
+
+
+#ifdef TS_GZIP_RESPONSES
+    // Each compressed response takes the window and about 800 bytes of code tables from the heap while it is decoded.
+    // A Photon or Electron often has no free 32 KB block, and the read then returns -307.  A smaller window fits, but
+    // a response that refers back further than the window fails with -303.
+    #ifndef TS_INFLATE_WINDOW_SIZE
+        #define TS_INFLATE_WINDOW_SIZE     32768   // Decoder window in bytes, smaller windows only decode streams compressed with a smaller window
+    #endif
+#endif
+
+    // Reads a response body from the client, removing chunked transfer encoding
+    class ThingSpeakBodyReader
+    {
+      public:
+        ThingSpeakBodyReader(Client & client, bool chunked, long contentLength) : client(client)
+        {
+            this->chunked = chunked;
+            this->remaining = chunked ? 0 : contentLength;
+            this->chunkStarted = false;
+            this->finished = false;
+            this->wireLength = 0;
+            this->hasDeadline = false;
+            this->deadline = 0;
+            this->expired = false;
+        }
         
-        Returns:
-        Code of 200 if successful.
-        Code of -101 if value is out of range or string is too long (> 255 bytes)
-        */
-        int setField(unsigned int field, String value)
+        // Stops reading at deadlineAt, a millis() value
+        void setDeadline(unsigned long deadlineAt)
         {
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, "setField " + String(field) + " to " + String(value), SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
-            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX) return TS_ERR_INVALID_FIELD_NUM;
-            // Max # bytes for ThingSpeak field is 255 (UTF-8)
-            if(value.length() > FIELDLENGTH_MAX) return TS_ERR_OUT_OF_RANGE;
-            this->nextWriteField[field - 1] = value;
-            return TS_OK_SUCCESS;
+            this->hasDeadline = true;
+            this->deadline = deadlineAt;
         }
         
-
-        /*
-        Function: setLatitude
+        // True if the body ended because the deadline passed
+        bool isExpired() const
+        {
+            return this->expired;
+        }
         
-        Summary:
-        Set the latitude of a multi-field update.
+        // Next byte of the body, or -1 at the end
+        int read()
+        {
+            if(this->finished)
+            {
+                return -1;
+            }
+            if(this->chunked && this->remaining == 0 && !readChunkSize())
+            {
+                this->finished = true;
+                return -1;
+            }
+            if(this->remaining == 0)
+            {
+                this->finished = true;
+                return -1;
+            }
+            int next = readByte();
+            if(next < 0)
+            {
+                this->finished = true;
+                return -1;
+            }
+            if(this->remaining > 0)
+            {
+                this->remaining--;
+            }
+            return next;
+        }
         
-        Parameters:
-        latitude - Latitude of the measurement as a floating point value (degrees N, use negative values for degrees S)
+        // Bytes received for the body, including chunk sizes
+        unsigned long getWireLength() const
+        {
+            return this->wireLength;
+        }
         
-        Returns:
-        Always return 200
+      private:
+        int readByte()
+        {
+            unsigned long startWaitAt = millis();
+            while(true)
+            {
+                int next = this->client.read();
+                if(next >= 0)
+                {
+                    this->wireLength++;
+                    return next;
+                }
+                if(this->hasDeadline && (long)(millis() - this->deadline) >= 0)
+                {
+                    this->expired = true;
+                    return -1;
+                }
+                if(!this->client.connected() || millis() - startWaitAt >= TIMEOUT_MS_SERVERRESPONSE)
+                {
+                    return -1;
+                }
+                delay(1);
+            }
+        }
         
-        Notes:
-        To record latitude, longitude and elevation of a write, call setField() for each of the fields you want to write. Then setLatitude(), setLongitude(), setElevation() and then call writeFields()
-        */
-        int setLatitude(float latitude)
+        // Reads the hexadecimal size line of the next chunk, false at the last chunk
+        bool readChunkSize()
         {
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, "ts::setLatitude(latitude: " + String(latitude,3) + "\")" , SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
-            this->nextWriteLatitude = latitude;
-            return TS_OK_SUCCESS;
+            int next;
+            if(this->chunkStarted)
+            {
+                // CRLF after the data of the previous chunk
+                while((next = readByte()) >= 0 && next != '\n');
+            }
+            this->chunkStarted = true;
+            
+            long size = 0;
+            bool inSize = true;
+            bool anyDigits = false;
+            while((next = readByte()) >= 0 && next != '\n')
+            {
+                int digit = (next >= '0' && next <= '9') ? next - '0' : (next >= 'a' && next <= 'f') ? next - 'a' + 10 : (next >= 'A' && next <= 'F') ? next - 'A' + 10 : -1;
+                if(inSize && digit >= 0)
+                {
+                    size = size * 16 + digit;
+                    anyDigits = true;
+                }
+                else
+                {
+                    // Chunk extensions are ignored
+                    inSize = false;
+                }
+            }
+            this->remaining = size;
+            return next >= 0 && anyDigits && size > 0;
         }
         
+        Client & client;
+        bool chunked;
+        bool chunkStarted;
+        bool finished;
+        long remaining;                        // Bytes left in the body or chunk, -1 to read until the server closes
+        unsigned long wireLength;
+        bool hasDeadline;
+        unsigned long deadline;
+        bool expired;
+    };
 
-        /*
-        Function: setLongitude
-        
-        Summary:
-        Set the longitude of a multi-field update.
+
+    #ifndef TS_READ_POOL_MAX
+        #define TS_READ_POOL_MAX           4       // Most connections readBatch() uses at once
+    #endif
+    #define TS_RESPONSE_LINE_MAX       128     // Longest status or header line kept, the rest of a line is ignored
+
+    // UTC time from the device clock when it is valid, otherwise from the Date headers of the responses received
+    class ThingSpeakClock
+    {
+      public:
+        ThingSpeakClock()
+        {
+            this->synced = false;
+            this->syncedTime = 0;
+            this->syncedAt = 0;
+        }
         
-        Parameters:
-        longitude - Longitude of the measurement as a floating point value (degrees E, use negative values for degrees W)
+        // Sets the clock from a Date header, like "Sun, 06 Nov 1994 08:49:37 GMT", received at receivedAt (millis())
+        bool sync(const char * date, unsigned long receivedAt)
+        {
+            static const char monthNames[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+            char month[4];
+            int day, year, hour, minute, second;
+            if(sscanf(date, "%*[^,], %d %3s %d %d:%d:%d", &day, month, &year, &hour, &minute, &second) != 6 || strlen(month) != 3)
+            {
+                return false;
+            }
+            const char * found = strstr(monthNames, month);
+            if(NULL == found || (found - monthNames) % 3 != 0)
+            {
+                return false;
+            }
+            
+            // Days since 1970-01-01 in the proleptic Gregorian calendar
+            int monthNumber = (found - monthNames) / 3 + 1;
+            year -= (monthNumber <= 2);
+            long era = (year >= 0 ? year : year - 399) / 400;
+            long yearOfEra = year - era * 400;
+            long dayOfYear = (153 * (monthNumber + (monthNumber > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+            long days = era * 146097 + yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear - 719468;
+            this->syncedTime = (time_t)(days * 86400L + hour * 3600L + minute * 60L + second);
+            // The header is cut to the second, so on average the server time was half a second later
+            this->syncedAt = receivedAt - 500;
+            this->synced = true;
+            return true;
+        }
         
-        Returns:
-        Always return 200
+        bool isValid()
+        {
+            return Time.isValid() || this->synced;
+        }
         
-        Notes:
-        To record latitude, longitude and elevation of a write, call setField() for each of the fields you want to write. Then setLatitude(), setLongitude(), setElevation() and then call writeFields()
-        */
-        int setLongitude(float longitude)
+        // UTC seconds, 0 if the time is not known
+        time_t now()
         {
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, "ts::setLongitude(longitude: " + String(longitude,3) + "\")" , SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
-            this->nextWriteLongitude = longitude;
-            return TS_OK_SUCCESS;
+            if(Time.isValid())
+            {
+                return Time.now();
+            }
+            return this->synced ? this->syncedTime + (time_t)((millis() - this->syncedAt) / 1000) : 0;
         }
         
+      private:
+        bool synced;
+        time_t syncedTime;                     // UTC seconds of the last Date header
+        unsigned long syncedAt;                // millis() at syncedTime
+    };
 
-        /*
-        Function: setElevation
-        
-        Summary:
-        Set the elevation of a multi-field update.
-        
-        Parameters:
-        elevation - Elevation of the measurement as a floating point value (meters above sea level)
-        
-        Returns:
-        Always return 200
-        
-        Notes:
-        To record latitude, longitude and elevation of a write, call setField() for each of the fields you want to write. Then setLatitude(), setLongitude(), setElevation() and then call writeFields()
-        */
-        int setElevation(float elevation)
+    // States of ThingSpeakResponseParser
+    #define TS_PARSE_STATUS_LINE       0
+    #define TS_PARSE_HEADERS           1
+    #define TS_PARSE_BODY              2
+    #define TS_PARSE_CHUNK_SIZE        3
+    #define TS_PARSE_CHUNK_DATA        4
+    #define TS_PARSE_CHUNK_END         5       // CRLF after the data of a chunk
+    #define TS_PARSE_DONE              6
+
+    // Parses an HTTP response fed to it a byte at a time, so several responses can be read side by side
+    class ThingSpeakResponseParser
+    {
+      public:
+        void begin(String * body, ThingSpeakClock * clock)
         {
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, "ts::setElevation(elevation: " + String(elevation,3) + "\")" , SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
-            this->nextWriteElevation = elevation;
-            return TS_OK_SUCCESS;
+            this->clock = clock;
+            this->state = TS_PARSE_STATUS_LINE;
+            this->line = "";
+            this->status = TS_ERR_BAD_RESPONSE;
+            this->contentLength = -1;
+            this->chunked = false;
+            this->remaining = 0;
+            this->body = body;
+            *this->body = "";
         }
         
-        
-        /*
-        Function: setStatus
-        
-        Summary:
-        Set the status field of a multi-field update.
-        
-        Parameters:
-        status - String to write (UTF8).  ThingSpeak limits this to 255 bytes.
-        
-        Returns:
-        Code of 200 if successful.
-        Code of -101 if string is too long (> 255 bytes)
-        
-        Notes:
-        To record a status message on a write, call setStatus() then call writeFields().
-        Use status to provide additonal details when writing a channel update.
-        */
-        int setStatus(String status)
+        // Returns true once the response is complete
+        bool feed(uint8_t c)
         {
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, "ts::setStatus(status: " + status + "\")" , SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
-            // Max # bytes for ThingSpeak field is 255 (UTF-8)
-            if(status.length() > FIELDLENGTH_MAX) return TS_ERR_OUT_OF_RANGE;
-            this->nextWriteStatus = status;
-            return TS_OK_SUCCESS;
-        }       
-       
-        
-        /*
-        Function: setCreatedAt
-        
-        Summary:
-        Set the created-at date of a multi-field update.
-        
-        Parameters:
-        createdAt - Desired timestamp to be included with the channel update as a String.  The timestamp string must be in the ISO 8601 format. Example "2017-01-12 13:22:54"
-        
-        Returns:
-        Code of 200 if successful.
-        Code of -101 if string is too long (> 255 bytes)
+            switch(this->state)
+            {
+                case TS_PARSE_BODY:
+                    *this->body += (char)c;
+                    if(this->contentLength >= 0 && --this->remaining <= 0)
+                    {
+                        this->state = TS_PARSE_DONE;
+                    }
+                    break;
+                case TS_PARSE_CHUNK_DATA:
+                    *this->body += (char)c;
+                    if(--this->remaining <= 0)
+                    {
+                        this->state = TS_PARSE_CHUNK_END;
+                    }
+                    break;
+                case TS_PARSE_CHUNK_END:
+                    if(c == '\n')
+                    {
+                        this->state = TS_PARSE_CHUNK_SIZE;
+                    }
+                    break;
+                case TS_PARSE_DONE:
+                    break;
+                default:
+                    if(c != '\n')
+                    {
+                        if(c != '\r' && this->line.length() < TS_RESPONSE_LINE_MAX)
+                        {
+                            this->line += (char)c;
+                        }
+                        break;
+                    }
+                    endOfLine();
+                    this->line = "";
+                    break;
+            }
+            return this->state == TS_PARSE_DONE;
+        }
         
-        Notes:
-        Timezones can be set using the timezone hour offset parameter. For example, a timestamp for Eastern Standard Time is: "2017-01-12 13:22:54-05".
-        If no timezone hour offset parameter is used, UTC time is assumed.
-        */
-        int setCreatedAt(String createdAt)
+        // Call when the server closes the connection, returns the final status
+        int finish()
         {
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, "ts::setCreatedAt(createdAt: " + createdAt + "\")" , SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
-            
-            // the ISO 8601 format is too complicated to check for valid timestamps here
-            // we'll need to reply on the api to tell us if there is a problem
-            // Max # bytes for ThingSpeak field is 255 (UTF-8)
-            if(createdAt.length() > FIELDLENGTH_MAX) return TS_ERR_OUT_OF_RANGE;
-            this->nextWriteCreatedAt = createdAt;
-            
-            return TS_OK_SUCCESS;
+            if(this->state == TS_PARSE_BODY && this->contentLength < 0)
+            {
+                // The body runs until the connection is closed
+                this->state = TS_PARSE_DONE;
+            }
+            if(this->state != TS_PARSE_DONE)
+            {
+                this->status = TS_ERR_BAD_RESPONSE;
+                this->state = TS_PARSE_DONE;
+            }
+            return this->status;
         }
         
+        int getStatus() const
+        {
+            return this->status;
+        }
         
-        /*
-        Function: writeFields
-        
-        Summary:
-        Write a multi-field update.
-        
-        Parameters:
-        channelNumber - Channel number
-        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
-        
-        Returns:
-        200 - successful.
-        404 - Incorrect API key (or invalid ThingSpeak server address)
-        -101 - Value is out of range or string is too long (> 255 characters)
-        -201 - Invalid field number specified
-        -210 - setField() was not called before writeFields()
-        -301 - Failed to connect to ThingSpeak
-        -302 - Unexpected failure during write to ThingSpeak
-        -303 - Unable to parse response
-        -304 - Timeout waiting for server to respond
-        -401 - Point was not inserted (most probable cause is the rate limit of once every 15 seconds)
-        
-        
-        Notes:
-        Call setField(), setLatitude(), setLongitude(), setElevation() and/or setStatus() and then call writeFields()
-        */
-        int writeFields(unsigned long channelNumber, const char * writeAPIKey)
+      private:
+        void endOfLine()
         {
-            String postMessage = String("");
-            bool fFirstItem = true;
-            for(size_t iField = 0; iField < 8; iField++)
+            if(this->state == TS_PARSE_STATUS_LINE)
             {
-                if(this->nextWriteField[iField].length() > 0)
+                if(!this->line.startsWith("HTTP/1."))
                 {
-                    if(!fFirstItem)
-                    {
-                        postMessage = postMessage + String("&");
-                    }
-                    postMessage = postMessage + String("field") + String(iField + 1) + String("=") + escapeUrl(this->nextWriteField[iField]);
-                    fFirstItem = false;
-                    this->nextWriteField[iField] = "";
+                    this->state = TS_PARSE_DONE;
+                    return;
                 }
+                this->status = this->line.substring(8).toInt();
+                this->state = TS_PARSE_HEADERS;
             }
-
-            if(!isnan(nextWriteLatitude))
+            else if(this->state == TS_PARSE_HEADERS)
             {
-                if(!fFirstItem)
+                if(this->line.length() > 0)
                 {
-                    postMessage = postMessage + String("&");
+                    int colon = this->line.indexOf(':');
+                    String name = this->line.substring(0, colon < 0 ? 0 : colon);
+                    name.toLowerCase();
+                    if(name == "content-length")
+                    {
+                        this->contentLength = this->line.substring(colon + 1).toInt();
+                    }
+                    else if(name == "transfer-encoding")
+                    {
+                        this->chunked = (this->line.indexOf("chunked") > colon);
+                    }
+                    else if(name == "date" && NULL != this->clock)
+                    {
+                        String value = this->line.substring(colon + 1);
+                        value.trim();
+                        this->clock->sync(value.c_str(), millis());
+                    }
                 }
-                postMessage = postMessage + String("lat=") + String(this->nextWriteLatitude);
-                fFirstItem = false;
-                this->nextWriteLatitude = NAN;
-            }
-
-            if(!isnan(this->nextWriteLongitude))
-            {
-                if(!fFirstItem)
+                else if(this->status != TS_OK_SUCCESS || this->contentLength == 0)
                 {
-                    postMessage = postMessage + String("&");
+                    // The body of an error is not kept
+                    this->state = TS_PARSE_DONE;
                 }
-                postMessage = postMessage + String("long=") + String(this->nextWriteLongitude);
-                fFirstItem = false;
-                this->nextWriteLongitude = NAN;
-            }
-
-
-            if(!isnan(this->nextWriteElevation))
-            {
-                if(!fFirstItem)
+                else
                 {
-                    postMessage = postMessage + String("&");
+                    this->remaining = this->contentLength;
+                    this->state = this->chunked ? TS_PARSE_CHUNK_SIZE : TS_PARSE_BODY;
                 }
-                postMessage = postMessage + String("elevation=") + String(this->nextWriteElevation);
-                fFirstItem = false;
-                this->nextWriteElevation = NAN;
             }
-            
-            if(this->nextWriteStatus.length() > 0)
+            else if(this->state == TS_PARSE_CHUNK_SIZE)
             {
-                if(!fFirstItem)
-                {
-                    postMessage = postMessage + String("&");
-                }
-                postMessage = postMessage + String("status=") + escapeUrl(this->nextWriteStatus);
-                fFirstItem = false;
-                this->nextWriteStatus = "";
+                this->remaining = strtol(this->line.c_str(), NULL, 16);
+                this->state = (this->remaining > 0) ? TS_PARSE_CHUNK_DATA : TS_PARSE_DONE;
             }
-            
-            if(this->nextWriteCreatedAt.length() > 0)
+        }
+        
+        uint8_t state;
+        String line;
+        int status;
+        long contentLength;
+        bool chunked;
+        long remaining;
+        String * body;
+        ThingSpeakClock * clock;               // Set from the Date header, or NULL
+    };
+
+
+    // One read of a readBatch()
+    typedef struct readRequestRecord
+    {
+        unsigned long channelNumber;
+        unsigned int field;                    // Field (1-8) to read the latest value of, or 0 to read URLSuffix
+        const char * URLSuffix;                // Used when field is 0, for example "/feeds.json?results=10"
+        const char * readAPIKey;               // NULL for a public channel
+        int status;                            // Result, the same values as getLastReadStatus()
+        String response;                       // Value or response read, empty if there was an error
+        unsigned long elapsedMs;               // Time from connecting to the end of the response
+        unsigned long bytes;                   // HTTP bytes sent and received
+    }readRequest;
+
+    #define TS_CSV_COLUMNS_MAX         16      // Columns of a CSV feed mapped by readCSVHeader()
+    #define TS_CSV_CREATED_AT          -2      // readCSVHeader() value of the created_at column
+
+    #define TS_STRINGIFY_VALUE(x)      #x
+    #define TS_STRINGIFY(x)            TS_STRINGIFY_VALUE(x)
+
+    #define TS_RATE_LIMIT_MS           15000   // Shortest time between updates of a channel with a free account
+
+    // One channel of a writeBatch(), kept from one cycle to the next to respect its rate limit
+    typedef struct channelUpdateRecord
+    {
+        unsigned long channelNumber;
+        const char * writeAPIKey;
+        unsigned long minIntervalMs;           // Shortest time between updates of this channel
+        String postMessage;                    // Update to send, set by stageChannelUpdate() or by hand
+        unsigned long lastWriteAt;             // millis() of the last update ThingSpeak accepted
+        bool written;                          // An update has been accepted
+        int status;                            // Result, the same values as writeFields() or -402
+        long entryID;                          // Entry ID of the update, 0 if it was not stored
+        unsigned long elapsedMs;               // Time from connecting to the end of the response
+        unsigned long bytes;                   // HTTP bytes sent and received
+        String response;                       // Used while the response is read
+    }channelUpdate;
+
+    #ifndef TS_BREAKER_THRESHOLD
+        #define TS_BREAKER_THRESHOLD       3       // Consecutive connect failures or timeouts that open the circuit breaker, 0 to never open it
+    #endif
+    #ifndef TS_BREAKER_BACKOFF_MS
+        #define TS_BREAKER_BACKOFF_MS      5000    // Time the breaker stays open before the first probe
+    #endif
+    #ifndef TS_BREAKER_BACKOFF_MAX_MS
+        #define TS_BREAKER_BACKOFF_MAX_MS  300000  // Longest time between probes, the time doubles after each failed probe
+    #endif
+
+    // States of ThingSpeakCircuitBreaker
+    #define TS_BREAKER_CLOSED          0       // Requests are sent
+    #define TS_BREAKER_OPEN            1       // Requests fail with -305 without using the network
+    #define TS_BREAKER_HALF_OPEN       2       // One probe request has been let through
+
+    // Stops requests to an unreachable server after repeated connect failures or timeouts, and lets one probe
+    // request through at a time on a backoff schedule until the server answers again
+    class ThingSpeakCircuitBreaker
+    {
+      public:
+        ThingSpeakCircuitBreaker()
+        {
+            configure(TS_BREAKER_THRESHOLD, TS_BREAKER_BACKOFF_MS, TS_BREAKER_BACKOFF_MAX_MS);
+        }
+        
+        void configure(unsigned int threshold, unsigned long backoffMs, unsigned long maxBackoffMs)
+        {
+            this->threshold = threshold;
+            this->initialBackoffMs = backoffMs;
+            this->maxBackoffMs = (maxBackoffMs < backoffMs) ? backoffMs : maxBackoffMs;
+            reset();
+        }
+        
+        void reset()
+        {
+            this->state = TS_BREAKER_CLOSED;
+            this->failures = 0;
+            this->backoffMs = this->initialBackoffMs;
+            this->openedAt = 0;
+        }
+        
+        // True if a request may be sent, an open breaker whose backoff has passed lets this request through as the probe
+        bool allowRequest()
+        {
+            if(this->state == TS_BREAKER_CLOSED)
             {
-                if(!fFirstItem)
-                {
-                    postMessage = postMessage + String("&");
-                }
-                postMessage = postMessage + String("created_at=") + String(this->nextWriteCreatedAt);
-                fFirstItem = false;
-                this->nextWriteCreatedAt = "";
+                return true;
             }
-            
-            
-            if(fFirstItem)
+            if(this->state == TS_BREAKER_OPEN && millis() - this->openedAt >= this->backoffMs)
             {
-                // setField was not called before writeFields
-                return TS_ERR_SETFIELD_NOT_CALLED;
+                this->state = TS_BREAKER_HALF_OPEN;
+                return true;
             }
-
-            return writeRaw(channelNumber, postMessage, writeAPIKey);
+            return false;
         }
-
-        
-        /*
-        Function: writeRaw
         
-        Summary:
-        Write a raw POST to a ThingSpeak channel
-        
-        Parameters:
-        channelNumber - Channel number
-        postMessage - Raw URL to write to ThingSpeak as a string.  See the documentation at https://thingspeak.com/docs/channels#update_feed.
-        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        // Records the result of a request that allowRequest() let through, true if it opened the breaker
+        bool recordResult(int status)
+        {
+            if(status != TS_ERR_CONNECT_FAILED && status != TS_ERR_TIMEOUT)
+            {
+                // The server answered, or at least accepted the connection
+                this->state = TS_BREAKER_CLOSED;
+                this->failures = 0;
+                this->backoffMs = this->initialBackoffMs;
+                return false;
+            }
+            if(this->failures < 0xFFFF)
+            {
+                this->failures++;
+            }
+            if(this->state == TS_BREAKER_HALF_OPEN)
+            {
+                // The probe failed, wait longer before the next one
+                this->backoffMs = (this->backoffMs > this->maxBackoffMs / 2) ? this->maxBackoffMs : this->backoffMs * 2;
+            }
+            else if(this->state == TS_BREAKER_OPEN || this->threshold == 0 || this->failures < this->threshold)
+            {
+                // A request sent before the breaker opened does not restart the backoff
+                return false;
+            }
+            this->state = TS_BREAKER_OPEN;
+            this->openedAt = millis();
+            return true;
+        }
         
-        Returns:
-        200 - successful.
-        404 - Incorrect API key (or invalid ThingSpeak server address)
-        -101 - Value is out of range or string is too long (> 255 characters)
-        -201 - Invalid field number specified
-        -210 - setField() was not called before writeFields()
-        -301 - Failed to connect to ThingSpeak
-        -302 - Unexpected failure during write to ThingSpeak
-        -303 - Unable to parse response
-        -304 - Timeout waiting for server to respond
-        -401 - Point was not inserted (most probable cause is the rate limit of once every 15 seconds)
+        uint8_t getState()
+        {
+            return this->state;
+        }
         
-        Notes:
-        This is low level functionality that will not be required by most users.
-        */
-        int writeRaw(unsigned long channelNumber, String postMessage, const char * writeAPIKey)
+        // Time until an open breaker lets a probe through
+        unsigned long getRetryIn()
         {
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, "ts::writeRaw   (channelNumber: " + String(channelNumber) + " writeAPIKey: " + String(writeAPIKey) + " postMessage: \"" + postMessage + "\")" , SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
-
-            if(!connectThingSpeak())
+            if(this->state != TS_BREAKER_OPEN)
             {
-                // Failed to connect to ThingSpeak
-                return TS_ERR_CONNECT_FAILED;
+                return 0;
             }
+            unsigned long elapsed = millis() - this->openedAt;
+            return (elapsed >= this->backoffMs) ? 0 : this->backoffMs - elapsed;
+        }
+        
+      private:
+        uint8_t state;
+        uint16_t failures;                     // Consecutive connect failures and timeouts
+        unsigned int threshold;
+        unsigned long initialBackoffMs;
+        unsigned long maxBackoffMs;
+        unsigned long backoffMs;               // Time from opening to the next probe
+        unsigned long openedAt;
+    };
 
-            postMessage = postMessage + String("&headers=false");
 
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, "Post " + postMessage, SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
+    // Priorities of writes, set with setPriority()
+    #define TS_PRIORITY_CRITICAL       0       // Sent first, never dropped to make room or held back by the data budget
+    #define TS_PRIORITY_NORMAL         1
+    #define TS_PRIORITY_BULK           2       // Sent last and dropped first, only the latest queued update of a channel is kept
 
+    // Periods of a data budget
+    #define TS_BUDGET_DAILY            0       // Starts again at midnight UTC
+    #define TS_BUDGET_MONTHLY          1       // Starts again on the first of the month, UTC
 
-            // Post data to thingspeak
-            if(!this->client->print("POST /update HTTP/1.1\r\n")) return abortWriteRaw();
-            if(!writeHTTPHeader(writeAPIKey)) return abortWriteRaw();
-            if(!this->client->print("Content-Type: application/x-www-form-urlencoded\r\n")) return abortWriteRaw();
-            if(!this->client->print("Content-Length: ")) return abortWriteRaw();
-            if(!this->client->print(postMessage.length())) return abortWriteRaw();
-            if(!this->client->print("\r\n\r\n")) return abortWriteRaw();
-            if(!this->client->print(postMessage)) return abortWriteRaw();
-      
-            String entryIDText = String();
-            int status = getHTTPResponse(entryIDText);
-            if(status != TS_OK_SUCCESS)
-            {
-                client->stop();
-                return status;
-            }
-            long entryID = entryIDText.toInt();
+    // Levels of the data budget governor
+    #define TS_BUDGET_NORMAL           0       // Everything is sent
+    #define TS_BUDGET_CONSERVE         1       // Writes are spaced out, bulk fields are left out and asynchronous writes are sent as bulk
+    #define TS_BUDGET_RESERVE          2       // Only critical writes are sent
 
-            #ifdef PRINT_DEBUG_MESSAGES
-            Particle.publish(SPARK_PUBLISH_TOPIC, "               Entry ID \"" + entryIDText + "\" (" + String(entryID) + ")" , SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
+    #ifndef TS_BUDGET_CONSERVE_PERCENT
+        #define TS_BUDGET_CONSERVE_PERCENT 75      // Share of the budget used when the governor starts to conserve
+    #endif
+    #ifndef TS_BUDGET_RESERVE_PERCENT
+        #define TS_BUDGET_RESERVE_PERCENT  95      // Share of the budget used when the rest is kept for critical writes
+    #endif
 
-            client->stop();
-            
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, "disconnected.", SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
-            if(entryID == 0)
-            {
-                // ThingSpeak did not accept the write
-                status = TS_ERR_NOT_INSERTED;
-            }
-            return status;
+    // Bytes used by requests in the current period of a data budget, and the level that follows from them
+    class ThingSpeakDataBudget
+    {
+      public:
+        ThingSpeakDataBudget()
+        {
+            this->limitBytes = 0;
+            this->period = TS_BUDGET_DAILY;
+            this->conserveIntervalMs = 0;
+            this->usedBytes = 0;
+            this->periodKey = -1;
+            this->bytesSent = 0;
+            this->bytesReceived = 0;
+            this->lastWriteAt = 0;
+            this->written = false;
+            this->clock = NULL;
         }
         
+        void setClock(ThingSpeakClock * clock)
+        {
+            this->clock = clock;
+        }
         
-        /*
-        Function: readStringField
+        void configure(unsigned long limitBytes, uint8_t period, unsigned long conserveIntervalMs)
+        {
+            this->limitBytes = limitBytes;
+            this->period = period;
+            this->conserveIntervalMs = conserveIntervalMs;
+            rollPeriod();
+        }
         
-        Summary:
-        Read the latest string from a private ThingSpeak channel
+        void charge(unsigned long sent, unsigned long received)
+        {
+            rollPeriod();
+            this->usedBytes += sent + received;
+            this->bytesSent += sent;
+            this->bytesReceived += received;
+        }
         
-        Parameters:
-        channelNumber - Channel number
-        field - Field number (1-8) within the channel to read from.
-        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        uint8_t getLevel()
+        {
+            rollPeriod();
+            if(0 == this->limitBytes)
+            {
+                return TS_BUDGET_NORMAL;
+            }
+            // Compare in 64 bits, limits of a few GB times 100 do not fit in 32
+            uint64_t used = (uint64_t)this->usedBytes * 100;
+            if(used >= (uint64_t)this->limitBytes * TS_BUDGET_RESERVE_PERCENT)
+            {
+                return TS_BUDGET_RESERVE;
+            }
+            if(used >= (uint64_t)this->limitBytes * TS_BUDGET_CONSERVE_PERCENT)
+            {
+                return TS_BUDGET_CONSERVE;
+            }
+            return TS_BUDGET_NORMAL;
+        }
         
-        Returns:
-        Value read (UTF8 string), or empty string if there is an error.  Use getLastReadStatus() to get more specific information.
-        */
-        String readStringField(unsigned long channelNumber, unsigned int field, const char * readAPIKey)
+        // True if a request may be sent at the current level
+        bool allowRequest(bool write, uint8_t priority)
         {
-            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX)
+            if(write && priority == TS_PRIORITY_CRITICAL)
             {
-                this->lastReadStatus = TS_ERR_INVALID_FIELD_NUM;
-                return("");
+                return true;
             }
-            #ifdef PRINT_DEBUG_MESSAGES
-                
-                if(NULL != readAPIKey)
-                {
-                    Particle.publish(SPARK_PUBLISH_TOPIC, "ts::readStringField(channelNumber: " + String(channelNumber) + " readAPIKey: " + String(readAPIKey) + " field: " + String(field) +")", SPARK_PUBLISH_TTL, PRIVATE);
-                }
-                else{
-                    Particle.publish(SPARK_PUBLISH_TOPIC, "ts::readStringField(channelNumber: " + String(channelNumber) + " field: " + String(field) + ")", SPARK_PUBLISH_TTL, PRIVATE);
-                }
-            #endif
-            return readRaw(channelNumber, String(String("/fields/") + String(field) + String("/last")), readAPIKey);
+            uint8_t level = getLevel();
+            if(level == TS_BUDGET_RESERVE)
+            {
+                return false;
+            }
+            if(level == TS_BUDGET_CONSERVE && write && this->written && millis() - this->lastWriteAt < this->conserveIntervalMs)
+            {
+                return false;
+            }
+            return true;
         }
         
-
-        /*
-        Function: readStringField
+        void recordWrite()
+        {
+            this->lastWriteAt = millis();
+            this->written = true;
+        }
         
-        Summary:
-        Read the latest string from a private ThingSpeak channel
+        // Restores the bytes used in the current period, for example from retained memory after a reset
+        void setUsed(unsigned long usedBytes)
+        {
+            rollPeriod();
+            this->usedBytes = usedBytes;
+        }
         
-        Parameters:
-        channelNumber - Channel number
-        field - Field number (1-8) within the channel to read from.
+        unsigned long getUsed()
+        {
+            rollPeriod();
+            return this->usedBytes;
+        }
         
-        Returns:
-        Value read (UTF8 string), or empty string if there is an error.  Use getLastReadStatus() to get more specific information.
-        */
-        String readStringField(unsigned long channelNumber, unsigned int field)
+        unsigned long getLimit()
         {
-            return readStringField(channelNumber, field, NULL);
+            return this->limitBytes;
         }
-
-
-        /*
-        Function: readFloatField
         
-        Summary:
-        ead the latest floating point value from a private ThingSpeak channel
+        long getPeriodKey()
+        {
+            rollPeriod();
+            return this->periodKey;
+        }
         
-        Parameters:
-        channelNumber - Channel number
-        field - Field number (1-8) within the channel to read from.
-        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        // Restores the bytes used in a period and when the last write was sent, a new period starts if it has ended
+        void restore(unsigned long usedBytes, long periodKey, unsigned long lastWriteAgeMs, bool written)
+        {
+            this->usedBytes = usedBytes;
+            this->periodKey = periodKey;
+            this->lastWriteAt = millis() - lastWriteAgeMs;
+            this->written = written;
+            rollPeriod();
+        }
         
-        Returns:
-        Value read, or 0 if the field is text or there is an error.  Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
-        */
-        float readFloatField(unsigned long channelNumber, unsigned int field, const char * readAPIKey)
+        unsigned long getConserveInterval()
         {
-            return convertStringToFloat(readStringField(channelNumber, field, readAPIKey));
+            return this->conserveIntervalMs;
         }
-
-
-        /*
-        Function: readFloatField
         
-        Summary:
-        Read the latest floating point value from a private ThingSpeak channel
+        unsigned long long getBytesSent()
+        {
+            return this->bytesSent;
+        }
         
-        Parameters:
-        channelNumber - Channel number
-        field - Field number (1-8) within the channel to read from.
+        unsigned long long getBytesReceived()
+        {
+            return this->bytesReceived;
+        }
         
-        Returns:
-        Value read, or 0 if the field is text or there is an error.  Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
-        */
-        float readFloatField(unsigned long channelNumber, unsigned int field)
+      private:
+        // Starts a new period when the UTC day or month changes; without a valid clock the period never ends
+        void rollPeriod()
         {
-            return readFloatField(channelNumber, field, NULL);
+            if(NULL == this->clock || !this->clock->isValid())
+            {
+                return;
+            }
+            time_t now = this->clock->now();
+            long key;
+            if(this->period == TS_BUDGET_MONTHLY)
+            {
+                struct tm utc;
+                gmtime_r(&now, &utc);
+                key = utc.tm_year * 12L + utc.tm_mon;
+            }
+            else
+            {
+                key = (long)(now / 86400L);
+            }
+            if(key != this->periodKey)
+            {
+                if(this->periodKey != -1)
+                {
+                    this->usedBytes = 0;
+                }
+                this->periodKey = key;
+            }
         }
+        
+        unsigned long limitBytes;              // 0 for no budget
+        uint8_t period;
+        unsigned long conserveIntervalMs;      // Shortest time between writes while conserving
+        unsigned long usedBytes;               // In the current period
+        long periodKey;                        // Day or month of the current period, -1 before the clock is valid
+        unsigned long long bytesSent;          // Since startup
+        unsigned long long bytesReceived;
+        unsigned long lastWriteAt;
+        bool written;
+        ThingSpeakClock * clock;
+    };
 
-
-        /*
-        Function: readLongField
+    // Passes everything through to another client, counting the bytes of each connection and charging them to a data budget
+    class ThingSpeakMeteredClient : public Client
+    {
+      public:
+        ThingSpeakMeteredClient()
+        {
+            this->target = NULL;
+            this->budget = NULL;
+            this->requestBytes = 0;
+            this->unchargedSent = 0;
+            this->unchargedReceived = 0;
+        }
         
-        Summary:
-        Read the latest long value from a private ThingSpeak channel
+        void attach(Client * target, ThingSpeakDataBudget * budget)
+        {
+            this->target = target;
+            this->budget = budget;
+        }
         
-        Parameters:
-        channelNumber - Channel number
-        field - Field number (1-8) within the channel to read from.
-        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        // Bytes sent and received since the last connect() or resetCount()
+        unsigned long getRequestBytes()
+        {
+            return this->requestBytes;
+        }
         
-        Returns:
-        Value read, or 0 if the field is text or there is an error.  Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
-        */
-        long readLongField(unsigned long channelNumber, unsigned int field, const char * readAPIKey)
+        void resetCount()
         {
-            // Note that although the function is called "toInt" it really returns a long.
-            return readStringField(channelNumber, field, readAPIKey).toInt();
+            this->requestBytes = 0;
         }
-
-
-        /*
-        Function: readLongField
         
-        Summary:
-        Read the latest long value from a private ThingSpeak channel
+        int connect(IPAddress ip, uint16_t port, network_interface_t nif = 0) override
+        {
+            settle();
+            this->requestBytes = 0;
+            return this->target->connect(ip, port, nif);
+        }
         
-        Parameters:
-        channelNumber - Channel number
-        field - Field number (1-8) within the channel to read from.
-        
-        Returns:
-        Value read, or 0 if the field is text or there is an error.  Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
-        */
-        long readLongField(unsigned long channelNumber, unsigned int field)
+        int connect(const char * host, uint16_t port, network_interface_t nif = 0) override
         {
-            return readLongField(channelNumber, field, NULL);
+            settle();
+            this->requestBytes = 0;
+            return this->target->connect(host, port, nif);
         }
-
-
-        /*
-        Function: readIntField
-        
-        Summary:
-        Read the latest int value from a private ThingSpeak channel
-        
-        Parameters:
-        channelNumber - Channel number
-        field - Field number (1-8) within the channel to read from.
-        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
         
-        Returns:
-        Value read, or 0 if the field is text or there is an error.  Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
-        */
-        int readIntField(unsigned long channelNumber, unsigned int field, const char * readAPIKey)
+        size_t write(uint8_t b)
         {
-            return readLongField(channelNumber, field, readAPIKey);
+            return count(this->target->write(b), 0);
         }
-
-
-        /*
-        Function: readIntField
-        
-        Summary:
-        Read the latest int value from a private ThingSpeak channel
         
-        Parameters:
-        channelNumber - Channel number
-        field - Field number (1-8) within the channel to read from.
-        
-        Returns:
-        Value read, or 0 if the field is text or there is an error.  Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
-        */
-        int readIntField(unsigned long channelNumber, unsigned int field)
+        size_t write(const uint8_t * buffer, size_t size)
         {
-            return readLongField(channelNumber, field, NULL);
+            return count(this->target->write(buffer, size), 0);
         }
         
-
-        /*
-        Function: readStatus
-        
-        Summary:
-        Read the latest status from a private ThingSpeak channel
-        
-        Parameters:
-        channelNumber - Channel number
-        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        int available()
+        {
+            return this->target->available();
+        }
         
-        Results:
-        Value read (UTF8 string). An empty string is returned if there was no status written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
-        */
-        String readStatus(unsigned long channelNumber, const char * readAPIKey)
+        int read()
         {
-            String content = readRaw(channelNumber, "/feeds/last.txt?status=true", readAPIKey);
-            
-            if(getLastReadStatus() != TS_OK_SUCCESS){
-                return String("");
+            int b = this->target->read();
+            if(b >= 0)
+            {
+                count(0, 1);
             }
-            
-            return getJSONValueByKey(content, "status");
+            return b;
         }
         
+        int read(uint8_t * buffer, size_t size)
+        {
+            int length = this->target->read(buffer, size);
+            if(length > 0)
+            {
+                count(0, length);
+            }
+            return length;
+        }
         
-        /*
-        Function: readStatus
-        
-        Summary:
-        Read the latest status from a private ThingSpeak channel
+        int peek()
+        {
+            return this->target->peek();
+        }
         
-        Parameters:
-        channelNumber - Channel number
+        void flush()
+        {
+            this->target->flush();
+        }
         
-        Results:
-        Value read (UTF8 string). An empty string is returned if there was no status written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
-        */
-        String readStatus(unsigned long channelNumber)
+        void stop()
         {
-            return readStatus(channelNumber, NULL);
+            this->target->stop();
+            settle();
         }
         
+        uint8_t connected()
+        {
+            return this->target->connected();
+        }
         
-        /*
-        Function: readCreatedAt
+        operator bool()
+        {
+            return NULL != this->target && (bool)*this->target;
+        }
         
-        Summary:
-        Read the created-at timestamp associated with the latest update to a private ThingSpeak channel
+        using Print::write;
         
-        Parameters:
-        channelNumber - Channel number
-        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
+      private:
+        // Only adds up, the bytes are charged to the budget once per connection by settle()
+        size_t count(size_t sent, size_t received)
+        {
+            this->requestBytes += sent + received;
+            this->unchargedSent += sent;
+            this->unchargedReceived += received;
+            return sent;
+        }
         
-        Results:
-        Value read (UTF8 string). An empty string is returned if there was no created-at timestamp written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
-        */
-        String readCreatedAt(unsigned long channelNumber, const char * readAPIKey)
+        // Charges the bytes counted since the last charge, called when the connection is stopped or replaced
+        void settle()
         {
-            String content = readRaw(channelNumber, "/feeds/last.txt", readAPIKey);
-            
-            if(getLastReadStatus() != TS_OK_SUCCESS){
-                return String("");
+            if(NULL != this->budget && (this->unchargedSent > 0 || this->unchargedReceived > 0))
+            {
+                this->budget->charge(this->unchargedSent, this->unchargedReceived);
             }
-            
-            return getJSONValueByKey(content, "created_at");
+            this->unchargedSent = 0;
+            this->unchargedReceived = 0;
         }
         
+        Client * target;
+        ThingSpeakDataBudget * budget;
+        unsigned long requestBytes;
+        unsigned long unchargedSent;
+        unsigned long unchargedReceived;
+    };
 
-        /*
-        Function: readCreatedAt
-        
-        Summary:
-        Read the created-at timestamp associated with the latest update to a private ThingSpeak channel
-        
-        Parameters:
-        channelNumber - Channel number
-            
-        Results:
-        Value read (UTF8 string). An empty string is returned if there was no created-at timestamp written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
-        */
-        String readCreatedAt(unsigned long channelNumber)
+
+    // A connection used by readBatch() or writeBatch() and the request it is running
+    typedef struct batchSlotRecord
+    {
+        int request;                           // -1 when the connection is free
+        unsigned long sentAt;
+        unsigned long startedAt;
+        ThingSpeakResponseParser parser;
+        ThingSpeakMeteredClient client;        // Counts the bytes of the request
+    }batchSlot;
+
+
+#if PLATFORM_THREADING
+
+    #ifndef TS_WORKER_QUEUE_LENGTH
+        #define TS_WORKER_QUEUE_LENGTH     4       // Requests queued for the worker thread, results are kept until this many newer requests are made
+    #endif
+    #ifndef TS_WORKER_STACK_SIZE
+        #define TS_WORKER_STACK_SIZE       3072    // Stack size of the worker thread in bytes
+    #endif
+    #ifndef TS_WORKER_CRITICAL_WAIT_MS
+        #define TS_WORKER_CRITICAL_WAIT_MS (2 * TIMEOUT_MS_SERVERRESPONSE)   // Longest a critical request waits for room when every pending request is critical
+    #endif
+    #define TS_WORKER_POLL_MS          5       // How often ThingSpeakFuture::wait() checks for completion
+
+    // State of a worker request
+    #define TS_REQUEST_FREE            0
+    #define TS_REQUEST_CLAIMED         1       // Being filled in by the calling thread
+    #define TS_REQUEST_QUEUED          2
+    #define TS_REQUEST_RUNNING         3
+    #define TS_REQUEST_DONE            4
+
+    // Operations run by the worker thread
+    #define TS_OPERATION_WRITE         0       // POST payload to /update
+    #define TS_OPERATION_READ          1       // GET /channels/<channelNumber><payload>
+
+    typedef void (*ThingSpeakCallback)(int status, const String & response, void * context);
+
+    // A request to the worker thread and its result
+    typedef struct workerRequestRecord
+    {
+        std::atomic<uint8_t> state;
+        std::atomic<unsigned long> sequence;   // Changes each time the request is reused
+        uint8_t operation;
+        uint8_t priority;
+        unsigned long channelNumber;
+        const char * apiKey;                   // Must stay valid until the request is done
+        String payload;
+        int status;
+        String response;
+        ThingSpeakCallback callback;           // Called on the worker thread, with -503 if the request was dropped
+        void * context;
+        Mutex resultLock;                      // Held while the request is reused for a new call, and while a future reads its result
+    }workerRequest;
+
+    // The callback of a dropped request, kept until the worker thread calls it with -503
+    typedef struct expiredCallbackRecord
+    {
+        std::atomic<uint8_t> state;            // TS_REQUEST_FREE, TS_REQUEST_CLAIMED while it is filled in, then TS_REQUEST_QUEUED
+        ThingSpeakCallback callback;
+        void * context;
+    }expiredCallback;
+
+    // Result of a call made in worker mode
+    class ThingSpeakFuture
+    {
+      public:
+        ThingSpeakFuture()
         {
-            return readCreatedAt(channelNumber, NULL);
+            this->request = NULL;
+            this->sequence = 0;
+            this->failure = TS_ERR_NOT_READY;
         }
         
+        ThingSpeakFuture(workerRequest * request, unsigned long sequence)
+        {
+            this->request = request;
+            this->sequence = sequence;
+            this->failure = TS_ERR_NOT_READY;
+        }
         
-        /*
-        Function: readRaw
-        
-        Summary:
-        Read a raw response from a public ThingSpeak channel
+        // A future for a call that could not be queued
+        ThingSpeakFuture(int failure)
+        {
+            this->request = NULL;
+            this->sequence = 0;
+            this->failure = failure;
+        }
         
-        Parameters:
-        channelNumber - Channel number
-        URLSuffix - Raw URL to write to ThingSpeak as a String.  See the documentation at https://thingspeak.com/docs/channels#get_feed
-        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        // False if the call could not be queued, getStatus() tells why
+        bool isValid() const
+        {
+            return NULL != this->request;
+        }
         
-        Returns:
-        Response if successful, or empty string. Use getLastReadStatus() to get more specific information.
+        // True once the call has finished, or if it could not be queued
+        bool isReady() const
+        {
+            if(NULL == this->request || this->request->sequence.load(std::memory_order_acquire) != this->sequence)
+            {
+                return true;
+            }
+            return this->request->state.load(std::memory_order_acquire) == TS_REQUEST_DONE;
+        }
         
-        Notes:
-        This is low level functionality that will not be required by most users.
-        */
-        String readRaw(unsigned long channelNumber, String URLSuffix, const char * readAPIKey)
+        // Waits up to timeoutMs for the call to finish, returns isReady()
+        bool wait(unsigned long timeoutMs) const
         {
-            #ifdef PRINT_DEBUG_MESSAGES
-                if(NULL != readAPIKey)
-                {
-                    Particle.publish(SPARK_PUBLISH_TOPIC, "ts::readRaw   (channelNumber: " + String(channelNumber) + " readAPIKey: " + String(readAPIKey) + " URLSuffix: \"" + URLSuffix + "\")" , SPARK_PUBLISH_TTL, PRIVATE);
-                }
-                else
+            unsigned long start = millis();
+            while(!isReady())
+            {
+                if(millis() - start >= timeoutMs)
                 {
-                    Particle.publish(SPARK_PUBLISH_TOPIC, "ts::readRaw   (channelNumber: " + String(channelNumber) + " URLSuffix: \"" + URLSuffix + "\")" , SPARK_PUBLISH_TTL, PRIVATE);
+                    return false;
                 }
-            #endif
-
-            if(!connectThingSpeak())
+                delay(TS_WORKER_POLL_MS);
+            }
+            return true;
+        }
+        
+        // Same values as the blocking call, or TS_ERR_NOT_READY, TS_ERR_QUEUE_FULL, TS_ERR_RESULT_EXPIRED
+        int getStatus() const
+        {
+            if(NULL == this->request)
+            {
+                return this->failure;
+            }
+            std::lock_guard<Mutex> lock(this->request->resultLock);
+            if(!isReady())
+            {
+                return TS_ERR_NOT_READY;
+            }
+            return isCurrent() ? this->request->status : TS_ERR_RESULT_EXPIRED;
+        }
+        
+        // Response of a read, or empty string if it failed or has not finished
+        String getResponse() const
+        {
+            if(NULL == this->request)
             {
-                this->lastReadStatus = TS_ERR_CONNECT_FAILED;
                 return String("");
             }
+            // The request can't be reused for a newer call while the lock is held, so the check holds for the copy
+            std::lock_guard<Mutex> lock(this->request->resultLock);
+            if(!isReady() || !isCurrent() || this->request->status != TS_OK_SUCCESS)
+            {
+                return String("");
+            }
+            return this->request->response;
+        }
+        
+      private:
+        // The request has not been reused for a newer call
+        bool isCurrent() const
+        {
+            return this->request->sequence.load(std::memory_order_acquire) == this->sequence;
+        }
+        
+        workerRequest * request;
+        unsigned long sequence;
+        int failure;
+    };
 
-            String URL = String("/channels/") + String(channelNumber) + URLSuffix;
+#endif
 
-            #ifdef PRINT_DEBUG_MESSAGES
-            Particle.publish(SPARK_PUBLISH_TOPIC,"               GET \"" + URL + "\"" , SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
+    
+    // Position of each value in a feedRecord; fields 1-8 are at 0-7
+    #define TS_FEED_STATUS             8
+    #define TS_FEED_LATITUDE           9
+    #define TS_FEED_LONGITUDE          10
+    #define TS_FEED_ELEVATION          11
+    #define TS_FEED_CREATED_AT         12
+    #define TS_FEED_VALUES             13
 
-            // Post data to thingspeak
-            if(!this->client->print("GET ")) return abortReadRaw();
-            if(!this->client->print(URL)) return abortReadRaw();
-            if(!this->client->print(" HTTP/1.1\r\n")) return abortReadRaw();
-            if(!writeHTTPHeader(readAPIKey)) return abortReadRaw();
-            if(!this->client->print("\r\n")) return abortReadRaw();
-     
-            String content = String();
-            int status = getHTTPResponse(content);
-            this->lastReadStatus = status;
+    // Formats of the content kept in a feedRecord
+    #define TS_FEED_FORMAT_JSON        0       // {"created_at":"...","field1":"...",...}
+    #define TS_FEED_FORMAT_CSV         1       // Header line followed by one record
+    #define TS_FEED_FORMAT_VALUE       2       // The bare value of a single field
+
+    
+    // The response from the readMultipleFields functionality, kept as received.
+    // The values are located in a single scan the first time one is fetched, and each value is decoded in place when it is fetched.
+    typedef struct feedRecord
+    {
+        tsFeedContent content;
+        uint16_t valueStart[TS_FEED_VALUES];
+        uint16_t valueLength[TS_FEED_VALUES];
+        uint16_t selected;     // Bitmask of the values that were requested
+        uint16_t decoded;      // Bitmask of the values that have been decoded in place
+        uint8_t format;
+        bool indexed;
+    }feed;
 
 
-            #ifdef PRINT_DEBUG_MESSAGES
-                if(status == TS_OK_SUCCESS)
-                {
-                    Particle.publish(SPARK_PUBLISH_TOPIC, "Read: \"" + content + "\"" , SPARK_PUBLISH_TTL, PRIVATE);
-                }
-            #endif
+#ifdef TS_WARM_START
 
-            client->stop();
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, "disconnected." , SPARK_PUBLISH_TTL, PRIVATE);
+    #ifndef TS_WARM_TEXT_LENGTH
+        #define TS_WARM_TEXT_LENGTH        32      // Longest staged text value or created-at kept in a warmState
+    #endif
+    #ifndef TS_WARM_STATUS_LENGTH
+        #define TS_WARM_STATUS_LENGTH      64      // Longest staged status kept in a warmState
+    #endif
+    #ifndef TS_WARM_FEED_LENGTH
+        #define TS_WARM_FEED_LENGTH        256     // Bytes of last-read feed values kept in a warmState
+    #endif
+    #define TS_WARM_MAGIC              0x54535731ul    // "TSW1", change when the layout of warmState changes
+
+    // A staged value kept in a warmState
+    typedef struct warmValueRecord
+    {
+        uint8_t type;
+        union
+        {
+            long longValue;
+            #ifndef TS_DISABLE_FLOAT
+            float floatValue;
+            decltype(stagedValue::samples) samples;
             #endif
+        };
+        char text[TS_WARM_TEXT_LENGTH + 1];
+    }warmValue;
 
-            if(status != TS_OK_SUCCESS)
-            {
-                // return status;
-                return String("");
-            }
+    // Snapshot of the library state for a retained variable, so a device that wakes from deep sleep starts warm
+    typedef struct warmStateRecord
+    {
+        uint32_t magic;
+        uint32_t checksum;                     // Fletcher-32 of everything after it
+        uint32_t savedAt;                      // UTC seconds, 0 if the clock was not valid
+        uint8_t serverIP[4];                   // Resolved address of the server, 0.0.0.0 if not known
+        warmValue fields[8];                   // Staged values not written yet
+        float latitude;
+        float longitude;
+        float elevation;
+        char status[TS_WARM_STATUS_LENGTH + 1];
+        char createdAt[TS_WARM_TEXT_LENGTH + 1];
+        uint32_t lastWriteTime;                // UTC seconds of the last write ThingSpeak accepted, 0 if not known
+        int32_t lastEntryID;
+        int32_t entryHighWaterMark;
+        uint32_t budgetUsed;
+        int32_t budgetPeriod;
+        uint32_t feedReadTime;                 // UTC seconds when the last feed was read, 0 if not known
+        uint16_t feedSelected;                 // Values of the last feed kept in feedValues
+        uint16_t feedLength[TS_FEED_VALUES];
+        char feedValues[TS_WARM_FEED_LENGTH];  // The kept values, one after another
+    }warmState;
 
-            // This is a workaround to a bug in the Spark implementation of String
-            return String("") + content;
+#endif
+
+    
+    // Builds the URL of a server-side aggregation query over the history of one field, see ThingSpeakClass::readAggregatedSeries()
+    class ThingSpeakQuery
+    {
+      public:
+        ThingSpeakQuery(unsigned int field)
+        {
+            this->field = field;
+            this->aggregate = TS_AGGREGATE_NONE;
+            this->period = 0;
+            this->minutes = 0;
+            this->days = 0;
+            this->results = 0;
+            this->decimals = -1;
+            this->valid = (field >= FIELDNUM_MIN && field <= FIELDNUM_MAX);
         }
         
+        // Average the values over each period (TS_PERIOD_10_MINUTES through TS_PERIOD_DAILY)
+        ThingSpeakQuery & average(unsigned int period) { return setAggregate(TS_AGGREGATE_AVERAGE, period); }
         
-        /*
-        Function: readRaw
+        // Median of the values over each period (TS_PERIOD_10_MINUTES through TS_PERIOD_DAILY)
+        ThingSpeakQuery & median(unsigned int period) { return setAggregate(TS_AGGREGATE_MEDIAN, period); }
         
-        Summary:
-        Read a raw response from a public ThingSpeak channel
+        // Sum of the values over each period (TS_PERIOD_10_MINUTES through TS_PERIOD_DAILY)
+        ThingSpeakQuery & sum(unsigned int period) { return setAggregate(TS_AGGREGATE_SUM, period); }
         
-        Parameters:
-        channelNumber - Channel number
-        URLSuffix - Raw URL to write to ThingSpeak as a String.  See the documentation at https://thingspeak.com/docs/channels#get_feed
+        // First value of each period (TS_PERIOD_10_MINUTES through TS_PERIOD_DAILY)
+        ThingSpeakQuery & timescale(unsigned int period) { return setAggregate(TS_AGGREGATE_TIMESCALE, period); }
         
-        Returns:
-        Response if successful, or empty string. Use getLastReadStatus() to get more specific information.
+        // Only include the values written in the last number of minutes
+        ThingSpeakQuery & lastMinutes(unsigned long minutes)
+        {
+            this->minutes = minutes;
+            return *this;
+        }
         
-        Notes:
-        This is low level functionality that will not be required by most users.
-        */
-        String readRaw(unsigned long channelNumber, String URLSuffix)
+        // Only include the values written in the last number of days
+        ThingSpeakQuery & lastDays(unsigned int days)
         {
-            return readRaw(channelNumber, URLSuffix, NULL);
+            this->days = days;
+            return *this;
         }
         
+        // Only include the last number of entries (1-8000)
+        ThingSpeakQuery & lastResults(unsigned int results)
+        {
+            if(results < 1 || results > TS_QUERY_RESULTS_MAX) this->valid = false;
+            this->results = results;
+            return *this;
+        }
         
-        /*
-        Function: readMultipleFields
-         
-        Summary:
-        Read all the field values, status message, location coordinates, and created-at timestamp associated with the latest feed to a private ThingSpeak channel and store the values locally in variables within a struct.
-         
-        Parameters:
-        channelNumber - Channel number
-        readAPIKey - Read API key associated with the channel. *If you share code with others, do _not_ share this key*
-         
-        Returns:
-        HTTP status code of 200 if successful.
+        // Round the aggregated values to the number of decimal places
+        ThingSpeakQuery & round(unsigned int decimals)
+        {
+            this->decimals = decimals;
+            return *this;
+        }
         
-        Notes:
-        See getLastReadStatus() for other possible return values.
-        */
-        int readMultipleFields(unsigned long channelNumber, const char * readAPIKey)
+        unsigned int getField() const
         {
-            String readCondition = "/feeds/last.txt?status=true&location=true";
-            
-            String multiContent = readRaw(channelNumber, readCondition, readAPIKey);
+            return this->field;
+        }
+        
+        bool isValid() const
+        {
+            return this->valid;
+        }
+        
+        // Creates the URL suffix (relative to /channels/<channelNumber>) for the query
+        String getURLSuffix() const
+        {
+            String URL = String("/fields/") + String(this->field) + String(".csv");
+            char separator = '?';
             
-            if(getLastReadStatus() != TS_OK_SUCCESS){
-                return getLastReadStatus();
+            if(this->aggregate != TS_AGGREGATE_NONE)
+            {
+                static const char * const aggregateNames[] = {"", "timescale", "average", "median", "sum"};
+                URL = URL + String(separator) + String(aggregateNames[this->aggregate]) + String("=");
+                URL = URL + ((this->period == TS_PERIOD_DAILY) ? String("daily") : String(this->period));
+                separator = '&';
             }
-            
-            this->lastFeed.nextReadField[0] = parseValues(multiContent, "field1");
-            this->lastFeed.nextReadField[1] = parseValues(multiContent, "field2");
-            this->lastFeed.nextReadField[2] = parseValues(multiContent, "field3");
-            this->lastFeed.nextReadField[3] = parseValues(multiContent, "field4");
-            this->lastFeed.nextReadField[4] = parseValues(multiContent, "field5");
-            this->lastFeed.nextReadField[5] = parseValues(multiContent, "field6");
-            this->lastFeed.nextReadField[6] = parseValues(multiContent, "field7");
-            this->lastFeed.nextReadField[7] = parseValues(multiContent, "field8");
-            this->lastFeed.nextReadCreatedAt = parseValues(multiContent, "created_at");
-            this->lastFeed.nextReadLatitude = parseValues(multiContent, "latitude");
-            this->lastFeed.nextReadLongitude = parseValues(multiContent, "longitude");
-            this->lastFeed.nextReadElevation = parseValues(multiContent, "elevation");
-            this->lastFeed.nextReadStatus = parseValues(multiContent, "status");
-            
-            return TS_OK_SUCCESS;
+            if(this->minutes > 0)
+            {
+                URL = URL + String(separator) + String("minutes=") + String(this->minutes);
+                separator = '&';
+            }
+            if(this->days > 0)
+            {
+                URL = URL + String(separator) + String("days=") + String(this->days);
+                separator = '&';
+            }
+            if(this->results > 0)
+            {
+                URL = URL + String(separator) + String("results=") + String(this->results);
+                separator = '&';
+            }
+            if(this->decimals >= 0)
+            {
+                URL = URL + String(separator) + String("round=") + String(this->decimals);
+            }
+            return URL;
+        }
+        
+      private:
+        ThingSpeakQuery & setAggregate(unsigned char aggregate, unsigned int period)
+        {
+            switch(period)
+            {
+                case TS_PERIOD_10_MINUTES:
+                case TS_PERIOD_15_MINUTES:
+                case TS_PERIOD_20_MINUTES:
+                case TS_PERIOD_30_MINUTES:
+                case TS_PERIOD_HOURLY:
+                case TS_PERIOD_4_HOURS:
+                case TS_PERIOD_12_HOURS:
+                case TS_PERIOD_24_HOURS:
+                case TS_PERIOD_DAILY:
+                    break;
+                default:
+                    // ThingSpeak only aggregates over these periods
+                    this->valid = false;
+                    break;
+            }
+            // ThingSpeak only applies one aggregation per request
+            if(this->aggregate != TS_AGGREGATE_NONE) this->valid = false;
+            this->aggregate = aggregate;
+            this->period = period;
+            return *this;
         }
         
+        unsigned int field;
+        unsigned char aggregate;
+        unsigned int period;
+        unsigned long minutes;
+        unsigned int days;
+        unsigned int results;
+        int decimals;
+        bool valid;
+    };
+
+    
+    // Enables Particle hardware to write or read data to or from ThingSpeak, an open data platform for the Internet of Things with MATLAB analytics and visualization.
+    class ThingSpeakClass
+    {
+        template <unsigned int SHARDS> friend class ThingSpeakVirtualChannel;
         
+      public:
+        ThingSpeakClass()
+        {
+            resetWriteFields();
+            this->lastReadStatus = TS_OK_SUCCESS;
+            memset(this->sampleReduction, TS_REDUCE_MEAN, sizeof(this->sampleReduction));
+            memset(this->fieldPriority, TS_PRIORITY_NORMAL, sizeof(this->fieldPriority));
+            this->nextWritePriority = TS_PRIORITY_NORMAL;
+            this->dataBudget.setClock(&this->clock);
+            this->timeBudgetMs = 0;
+            this->nextDeadline = 0;
+            this->nextDeadlineSet = false;
+            this->operationDeadline = 0;
+            this->deadlineActive = false;
+            #ifndef TS_DISABLE_READS
+                this->lastFeed.selected = 0;
+                this->lastFeed.indexed = false;
+            #endif
+            this->lastEntryID = 0;
+            this->entryHighWaterMark = 0;
+            this->idempotentWrites = false;
+            this->fireAndForget = false;
+            this->writeInFlight = false;
+            this->writeSentAt = 0;
+            this->confirmedWrites = 0;
+            this->failedWrites = 0;
+            this->unconfirmedWrites = 0;
+            this->prepared = false;
+            this->preparedAt = 0;
+            this->autoPrepareIntervalMs = 0;
+            this->autoPrepareLeadMs = 0;
+            this->autoPrepareDone = false;
+            this->lastWriteStartedAt = 0;
+            #ifdef TS_WARM_START
+                this->lastWriteTime = 0;
+                this->feedReadTime = 0;
+            #endif
+            this->requestETag = NULL;
+            this->responseETag = NULL;
+            #ifdef TS_GZIP_RESPONSES
+                this->lastResponseWireLength = 0;
+            #endif
+            #if PLATFORM_THREADING
+                this->workerThread = NULL;
+                this->workerQueue = NULL;
+                this->nextWorkerRequest.store(0);
+                this->workerSequence.store(0);
+                for(size_t i = 0; i < TS_WORKER_QUEUE_LENGTH; i++)
+                {
+                    this->workerRequests[i].state.store(TS_REQUEST_FREE);
+                    this->workerRequests[i].sequence.store(0);
+                    this->expiredCallbacks[i].state.store(TS_REQUEST_FREE);
+                }
+            #endif
+        };
+
         /*
-        Function: readMultipleFields
+        Function: begin
         
         Summary:
-        Read all the field values, status message, location coordinates, and created-at timestamp associated with the latest update to a private ThingSpeak channel and store the values locally in variables within a struct.
-         
+        Initializes the ThingSpeak library and network settings using the ThingSpeak.com service.
+        
         Parameters:
-        channelNumber - Channel number
-        readAPIKey - Read API key associated with the channel. *If you share code with others, do _not_ share this key*
-         
+        client - TCPClient created earlier in the sketch
+        
         Returns:
-        HTTP status code of 200 if successful.
+        Always returns true
         
         Notes:
-        See getLastReadStatus() for other possible return values.
+        This does not validate the information passed in, or generate any calls to ThingSpeak.
         */
-        int readMultipleFields(unsigned long channelNumber)
+        bool begin(Client & client)
         {
-            return readMultipleFields(channelNumber, NULL);
+            TS_LOG_INFO(TS_EVENT_BEGIN, 0, 0);
+            this->setClient(&client);
+            this->setPort(THINGSPEAK_PORT_NUMBER);
+            resetWriteFields();
+            this->lastReadStatus = TS_OK_SUCCESS;
+            return true;
         }
         
         
         /*
-        Function: getFieldAsString
-         
+        Function: writeField
+        
         Summary:
-        Fetch the value as string from the latest stored feed record.
+        Write an integer value to a single field in a ThingSpeak channel
         
         Parameters:
-        field - Field number (1-8) within the channel to read from.
+        channelNumber - Channel number
+        field - Field number (1-8) within the channel to write to.
+        value - Integer value (from -32,768 to 32,767) to write.
+        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
         
         Returns:
-        Value read (UTF8 string), empty string if there is an error, or old value read (UTF8 string) if invoked before readMultipleFields().  Use getLastReadStatus() to get more specific information.
+        HTTP status code of 200 if successful.
+        
+        Notes:
+        See getLastReadStatus() for other possible return values.
         */
-        String getFieldAsString(unsigned int field)
+        int writeField(unsigned long channelNumber, unsigned int field, int value, const char * writeAPIKey)
         {
-            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX)
-            {
-                this->lastReadStatus = TS_ERR_INVALID_FIELD_NUM;
-                return("");
-            }
-            
-            this->lastReadStatus = TS_OK_SUCCESS;
-            return this->lastFeed.nextReadField[field-1];
+            // On Spark, int and long are the same, so map to the long version
+            return writeField(channelNumber, field, (long)value, writeAPIKey);
         }
         
-        
+
         /*
-        Function: getFieldAsFloat
-         
+        Function: writeField
+        
         Summary:
-        Fetch the value as float from the latest stored feed record.
+        Write a long value to a single field in a ThingSpeak channel
         
         Parameters:
-        field - Field number (1-8) within the channel to read from.
+        channelNumber - Channel number
+        field - Field number (1-8) within the channel to write to.
+        value - Long value (from -2,147,483,648 to 2,147,483,647) to write.
+        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
         
         Returns:
-        Value read, 0 if the field is text or there is an error, or old value read if invoked before readMultipleFields(). Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
+        HTTP status code of 200 if successful.
+        
+        Notes:
+        See getLastReadStatus() for other possible return values.
         */
-        float getFieldAsFloat(unsigned int field)
+        int writeField(unsigned long channelNumber, unsigned int field, long value, const char * writeAPIKey)
         {
-            return convertStringToFloat(getFieldAsString(field));
+            char valueString[15];  // long range is -2147483648 to 2147483647, so 12 bytes including terminator
+            ltoa(value, valueString, 10);
+            return writeField(channelNumber, field, valueString, writeAPIKey);
         }
+
         
-        
+        #ifndef TS_DISABLE_FLOAT
         /*
-        Function: getFieldAsLong
+        Function: writeField
         
         Summary:
-        Fetch the value as long from the latest stored feed record.
+        Write a floating point value to a single field in a ThingSpeak channel
         
         Parameters:
-        field - Field number (1-8) within the channel to read from.
+        channelNumber - Channel number
+        field - Field number (1-8) within the channel to write to.
+        value - Floating point value (from -999999000000 to 999999000000) to write.  If you need more accuracy, or a wider range, you should format the number using <tt>dtostrf</tt> and writeField().
+        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
         
         Returns:
-        Value read, 0 if the field is text or there is an error, or old value read if invoked before readMultipleFields(). Use getLastReadStatus() to get more specific information.
+        HTTP status code of 200 if successful.
+        
+        Notes:
+        See getLastReadStatus() for other possible return values.
         */
-        long getFieldAsLong(unsigned int field)
+        int writeField(unsigned long channelNumber, unsigned int field, float value, const char * writeAPIKey)
         {
-            // Note that although the function is called "toInt" it really returns a long.
-            return getFieldAsString(field).toInt();
+            TS_LOG_INFO(TS_EVENT_WRITE_FIELD, channelNumber, field);
+            char valueString[20]; // range is -999999000000.00000 to 999999000000.00000, so 19 + 1 for the terminator
+            int status = convertFloatToChar(value, valueString);
+            if(status != TS_OK_SUCCESS) return status;
+
+            return writeField(channelNumber, field, valueString, writeAPIKey);
         }
+        #else
+        // Compiled out by TS_DISABLE_FLOAT, pass a long or a string instead
+        int writeField(unsigned long channelNumber, unsigned int field, float value, const char * writeAPIKey) = delete;
+        int writeField(unsigned long channelNumber, unsigned int field, double value, const char * writeAPIKey) = delete;
+        #endif
         
-        
+
         /*
-        Function: getFieldAsInt
-         
+        Function: writeField
+        
         Summary:
-        Fetch the value as int from the latest stored feed record.
+        Write a string to a single field in a ThingSpeak channel
         
         Parameters:
-        field - Field number (1-8) within the channel to read from.
+        channelNumber - Channel number
+        field - Field number (1-8) within the channel to write to.
+        value - String to write (UTF8 string).  ThingSpeak limits this field to 255 bytes.
+        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
         
         Returns:
-        Value read, 0 if the field is text or there is an error, or old value read if invoked before readMultipleFields(). Use getLastReadStatus() to get more specific information.
+        HTTP status code of 200 if successful.
+        
+        Notes:
+        See getLastReadStatus() for other possible return values.
         */
-        int getFieldAsInt(unsigned int field)
+        int writeField(unsigned long channelNumber, unsigned int field, String value, const char * writeAPIKey)
         {
-            // int and long are same
-            return getFieldAsLong(field);
+            // Invalid field number specified
+            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX) return TS_ERR_INVALID_FIELD_NUM;
+            // Max # bytes for ThingSpeak field is 255
+            if(value.length() > FIELDLENGTH_MAX) return TS_ERR_OUT_OF_RANGE;
+            
+            TS_LOG_INFO(TS_EVENT_WRITE_FIELD, channelNumber, field);
+            String postMessage = String("field") + String(field) + "=" + escapeUrl(value);
+            return writeRaw(channelNumber, postMessage, writeAPIKey);
         }
         
-        
+
         /*
-        Function: getStatus
-         
+        Function: setField
+        
         Summary:
-        Fetch the status message associated with the latest stored feed record.
+        Set the value of a single field that will be part of a multi-field update.
         
-        Results:
-        Value read (UTF8 string). An empty string is returned if there was no status written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        Parameters:
+        field - Field number (1-8) within the channel to set.
+        value - Integer value (from -32,768 to 32,767) to set.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if value is out of range or string is too long (> 255 bytes)
         */
-        String getStatus()
+        int setField(unsigned int field, int value)
         {
-            return this->lastFeed.nextReadStatus;
+            // On Spark, int and long are the same, so map to the long version
+            return setField(field, (long)value);
         }
         
-        
+
         /*
-        Function: getLatitude
-         
+        Function: setField
+        
         Summary:
-        Fetch the latitude associated with the latest stored feed record.
+        Set the value of a single field that will be part of a multi-field update.
         
-        Results:
-        Value read (UTF8 string). An empty string is returned if there was no latitude written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        Parameters:
+        field - Field number (1-8) within the channel to set.
+        value - Long value (from -2,147,483,648 to 2,147,483,647) to write.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if value is out of range or string is too long (> 255 bytes)
         */
-        String getLatitude()
+        int setField(unsigned int field, long value)
         {
-            return this->lastFeed.nextReadLatitude;
+            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX) return TS_ERR_INVALID_FIELD_NUM;
+            // Formatted when the update is sent
+            this->nextWriteField[field - 1].type = TS_VALUE_LONG;
+            this->nextWriteField[field - 1].longValue = value;
+            return TS_OK_SUCCESS;
         }
         
-        
+
+        #ifndef TS_DISABLE_FLOAT
         /*
-        Function: getLongitude
-         
+        Function: setField
+        
         Summary:
-        Fetch the longitude associated with the latest stored feed record.
+        Set the value of a single field that will be part of a multi-field update.
         
-        Results:
-        Value read (UTF8 string). An empty string is returned if there was no longitude written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        Parameters:
+        field - Field number (1-8) within the channel to set.
+        value - Floating point value (from -999999000000 to 999999000000) to write.  If you need more accuracy, or a wider range, you should format the number yourself (using <tt>dtostrf</tt>) and setField() using the resulting string.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if value is out of range or string is too long (> 255 bytes)
         */
-        String getLongitude()
+        int setField(unsigned int field, float value)
         {
-            return this->lastFeed.nextReadLongitude;
+            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX) return TS_ERR_INVALID_FIELD_NUM;
+            if(!isFloatInRange(value)) return TS_ERR_OUT_OF_RANGE;
+            // Formatted when the update is sent
+            this->nextWriteField[field - 1].type = TS_VALUE_FLOAT;
+            this->nextWriteField[field - 1].floatValue = value;
+            return TS_OK_SUCCESS;
         }
+        #else
+        // Compiled out by TS_DISABLE_FLOAT, pass a long or a string instead
+        int setField(unsigned int field, float value) = delete;
+        int setField(unsigned int field, double value) = delete;
+        #endif
         
-        
+
         /*
-        Function: getElevation
-         
-        Summary:
-        Fetch the longitude associated with the latest stored feed record.
+        Function: setField
         
-        Results:
-        Value read (UTF8 string). An empty string is returned if there was no elevation written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        Summary:
+        Set the value of a single field that will be part of a multi-field update.
+        
+        Parameters:
+        field - Field number (1-8) within the channel to set.
+        value - String to write (UTF8).  ThingSpeak limits this to 255 bytes.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if value is out of range or string is too long (> 255 bytes)
         */
-        String getElevation()
+        int setField(unsigned int field, String value)
+        {
+            return setField(field, value.c_str());
+        }
+        
+
+        /*
+        Function: setField
+        
+        Summary:
+        Set the value of a single field that will be part of a multi-field update.
+        
+        Parameters:
+        field - Field number (1-8) within the channel to set.
+        value - Character array (zero terminated) to write (UTF8).  ThingSpeak limits this to 255 bytes.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if value is NULL or string is too long (> 255 bytes, or TS_COMPACT_FIELD_LENGTH when TS_COMPACT_STORAGE is defined)
+        */
+        int setField(unsigned int field, const char * value)
         {
-            return this->lastFeed.nextReadElevation;
+            TS_LOG_TRACE(TS_EVENT_SET_FIELD, field, 0);
+            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX) return TS_ERR_INVALID_FIELD_NUM;
+            // Max # bytes for ThingSpeak field is 255 (UTF-8)
+            if(NULL == value || strlen(value) > TS_FIELD_VALUE_MAX) return TS_ERR_OUT_OF_RANGE;
+            // An empty string leaves the field out of the update
+            this->nextWriteField[field - 1].type = (*value == '\0') ? TS_VALUE_NONE : TS_VALUE_TEXT;
+            this->nextWriteField[field - 1].text = value;
+            return TS_OK_SUCCESS;
         }
         
         
+        #ifndef TS_DISABLE_FLOAT
         /*
-        Function: getCreatedAt
-         
+        Function: addSample
+        
         Summary:
-        Fetch the created-at timestamp associated with the latest stored feed record.
+        Add a sample to the running statistics of a field that will be part of a multi-field update.
         
-        Results:
-        Value read (UTF8 string). An empty string is returned if there was no created-at timestamp written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        Parameters:
+        field - Field number (1-8) within the channel to set.
+        value - Floating point value (from -999999000000 to 999999000000) sampled.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if value is out of range or not a number
+        
+        Notes:
+        Only the count, sum, minimum, maximum and last sample are kept, so any number of samples can be added between writes.
+        writeFields() sends the reduction chosen with setSampleReduction(), the mean by default, and starts new statistics.
+        Calling setField() replaces the statistics with the value set.
         */
-        String getCreatedAt()
+        int addSample(unsigned int field, float value)
         {
-            return this->lastFeed.nextReadCreatedAt;
+            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX) return TS_ERR_INVALID_FIELD_NUM;
+            if(isnan(value) || isinf(value) || !isFloatInRange(value)) return TS_ERR_OUT_OF_RANGE;
+            
+            stagedValue & staged = this->nextWriteField[field - 1];
+            if(staged.type != TS_VALUE_SAMPLES)
+            {
+                staged.type = TS_VALUE_SAMPLES;
+                staged.samples.sum = 0;
+                staged.samples.minimum = value;
+                staged.samples.maximum = value;
+                staged.samples.count = 0;
+            }
+            staged.samples.sum += value;
+            if(value < staged.samples.minimum) staged.samples.minimum = value;
+            if(value > staged.samples.maximum) staged.samples.maximum = value;
+            staged.samples.last = value;
+            staged.samples.count++;
+            return TS_OK_SUCCESS;
         }
         
         
         /*
-        Function: getLastReadStatus
+        Function: setSampleReduction
         
         Summary:
-        Get the status of the previous read.
+        Choose how the samples added to a field with addSample() are written by writeFields().
+        
+        Parameters:
+        field - Field number (1-8) within the channel.
+        reduction - TS_REDUCE_MEAN (default), TS_REDUCE_MIN, TS_REDUCE_MAX, TS_REDUCE_SUM, TS_REDUCE_LAST, or TS_REDUCE_MINMAX_STATUS to write the mean and append "fieldN min <minimum> max <maximum>" to the status.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if the reduction is not known, or is TS_REDUCE_MINMAX_STATUS when TS_DISABLE_STATUS is defined
+        
+        Notes:
+        The reduction is kept for every following update.
+        */
+        int setSampleReduction(unsigned int field, unsigned int reduction)
+        {
+            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX) return TS_ERR_INVALID_FIELD_NUM;
+            if(reduction > TS_REDUCE_MINMAX_STATUS) return TS_ERR_OUT_OF_RANGE;
+            #ifdef TS_DISABLE_STATUS
+            if(reduction == TS_REDUCE_MINMAX_STATUS) return TS_ERR_OUT_OF_RANGE;
+            #endif
+            this->sampleReduction[field - 1] = reduction;
+            return TS_OK_SUCCESS;
+        }
+        #endif
+        
+        
+        /*
+        Function: setFieldPriority
+        
+        Summary:
+        Set the priority of a field, so the data budget governor can leave it out of updates.
+        
+        Parameters:
+        field - Field number (1-8) within the channel.
+        priority - TS_PRIORITY_NORMAL (default) or TS_PRIORITY_BULK to leave the field out of updates while the governor conserves data
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if the priority is not known
+        
+        Notes:
+        The priority is kept for every following update.
+        */
+        int setFieldPriority(unsigned int field, uint8_t priority)
+        {
+            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX) return TS_ERR_INVALID_FIELD_NUM;
+            if(priority > TS_PRIORITY_BULK) return TS_ERR_OUT_OF_RANGE;
+            this->fieldPriority[field - 1] = priority;
+            return TS_OK_SUCCESS;
+        }
+        
+        
+        /*
+        Function: setPriority
+        
+        Summary:
+        Set the priority of the next write.
+        
+        Parameters:
+        priority - TS_PRIORITY_CRITICAL, TS_PRIORITY_NORMAL (the default), or TS_PRIORITY_BULK
         
         Returns:
-        Generally, these are HTTP status codes.  Negative values indicate an error generated by the library.
-        Possible response codes...
         200 - OK / Success
-        404 - Incorrect API key (or invalid ThingSpeak server address)
-        -101 - Value is out of range or string is too long (> 255 characters)
-        -201 - Invalid field number specified
-        -210 - setField() was not called before writeFields()
-        -301 - Failed to connect to ThingSpeak
-        -302 -  Unexpected failure during write to ThingSpeak
-        -303 - Unable to parse response
-        -304 - Timeout waiting for server to respond
-        -401 - Point was not inserted (most probable cause is exceeding the rate limit)
+        -101 - Value is out of range
         
         Notes:
-        The read functions will return zero or empty if there is an error.  Use this function to retrieve the details.
+        A critical write is sent even when the data budget governor holds back other requests.  In worker mode, the worker thread sends queued requests in order of priority, oldest first within a priority.  When the queue is full, the oldest request of the lowest priority below the new one is dropped, and its future and callback get -503.  A critical write is never dropped: if every queued request is critical, writeFieldsAsync() waits until the worker takes one.  A bulk write also replaces any bulk write to the same channel that is still queued, so routine telemetry is downsampled to the latest update while the worker is busy.  The priority goes back to normal after each write.
         */
-        int getLastReadStatus()
+        int setPriority(uint8_t priority)
         {
-            return this->lastReadStatus;
+            if(priority > TS_PRIORITY_BULK) return TS_ERR_OUT_OF_RANGE;
+            this->nextWritePriority = priority;
+            return TS_OK_SUCCESS;
         }
         
         
-    private:
+        /*
+        Function: setTimeBudget
         
-        // Creates a new String
-        String escapeUrl(String message){
-            char t;
-            char ch[] = " ";
-            char temp[4];
-            char *encoded;
-            String result = "";
-            unsigned int i;
-            unsigned int n = message.length() + 1;  // add an extra for the null
-            
-            // figure out the length of the char array
-            for(i = 0; i < message.length(); i++){
-                t = message.charAt(i);
-                if( (t >= 0x00 && t <= 0x1F) || t >= 0x80 ){
-                    n--;
-                    continue;
+        Summary:
+        Limit how long each read, write or batch may take.
+        
+        Parameters:
+        budgetMs - Milliseconds from the start of each call until its deadline, 0 (the default) for no deadline
+        
+        Notes:
+        Every wait inside a call, for the response, each header line and the body, is cut short at the deadline, and the call returns -306 instead of waiting out the full response timeout.  A call whose deadline passes while it connects stops before sending its request.  The connection itself can't be interrupted, so a slow connect() may still run past the deadline.  A batch does not start requests after its deadline, and requests still waiting for an answer get -306.  The time budget also applies to the requests the worker thread sends.
+        */
+        void setTimeBudget(unsigned long budgetMs)
+        {
+            this->timeBudgetMs = budgetMs;
+        }
+        
+        
+        /*
+        Function: setDeadline
+        
+        Summary:
+        Set the deadline of the next read, write or batch.
+        
+        Parameters:
+        deadline - Value of millis() by which the next call must finish
+        
+        Notes:
+        Use this when several calls share one time slot, for example a sketch that must go back to sleep at a fixed time: pass the same deadline before each call.  The deadline replaces the time budget for the next call only, and works the same way as the one set by setTimeBudget().  A deadline that has already passed makes the next call return -306 without using the network.
+        */
+        void setDeadline(unsigned long deadline)
+        {
+            this->nextDeadline = deadline;
+            this->nextDeadlineSet = true;
+        }
+        
+        
+        #ifndef TS_DISABLE_FLOAT
+        /*
+        Function: getSampleCount
+        
+        Summary:
+        Get the number of samples added to a field with addSample() since the last write.
+        
+        Parameters:
+        field - Field number (1-8) within the channel.
+        
+        Returns:
+        Number of samples, or 0 if the field has no samples or the field number is invalid.
+        */
+        unsigned long getSampleCount(unsigned int field)
+        {
+            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX) return 0;
+            if(this->nextWriteField[field - 1].type != TS_VALUE_SAMPLES) return 0;
+            return this->nextWriteField[field - 1].samples.count;
+        }
+        #endif
+        
+        
+        /*
+        Function: queueField
+        
+        Summary:
+        Queue the value of a single field for the next multi-field update, from a thread, timer or ISR other than the one that writes.
+        
+        Parameters:
+        field - Field number (1-8) within the channel to set.
+        value - Long value (from -2,147,483,648 to 2,147,483,647) to write.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -501 if the queue is full and the value was dropped
+        
+        Notes:
+        The queue has room for TS_STAGING_QUEUE_LENGTH values.  It takes no lock and allocates no memory, but only one producer may queue values and only one thread may write.
+        writeFields() applies the queued values as if setField() had been called, in the order they were queued.
+        */
+        int queueField(unsigned int field, long value)
+        {
+            queuedValue queued;
+            queued.type = TS_VALUE_LONG;
+            queued.longValue = value;
+            return queueValue(field, queued);
+        }
+        
+        
+        /*
+        Function: queueField
+        
+        Summary:
+        Queue the value of a single field for the next multi-field update, from a thread, timer or ISR other than the one that writes.
+        
+        Parameters:
+        field - Field number (1-8) within the channel to set.
+        value - Integer value (from -32,768 to 32,767) to write.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -501 if the queue is full and the value was dropped
+        */
+        int queueField(unsigned int field, int value)
+        {
+            // On Spark, int and long are the same, so map to the long version
+            return queueField(field, (long)value);
+        }
+        
+        
+        #ifndef TS_DISABLE_FLOAT
+        /*
+        Function: queueField
+        
+        Summary:
+        Queue the value of a single field for the next multi-field update, from a thread, timer or ISR other than the one that writes.
+        
+        Parameters:
+        field - Field number (1-8) within the channel to set.
+        value - Floating point value (from -999999000000 to 999999000000) to write.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if value is out of range
+        Code of -501 if the queue is full and the value was dropped
+        */
+        int queueField(unsigned int field, float value)
+        {
+            if(!isFloatInRange(value)) return TS_ERR_OUT_OF_RANGE;
+            queuedValue queued;
+            queued.type = TS_VALUE_FLOAT;
+            queued.floatValue = value;
+            return queueValue(field, queued);
+        }
+        
+        
+        /*
+        Function: queueSample
+        
+        Summary:
+        Queue a sample for the running statistics of a field, from a thread, timer or ISR other than the one that writes.
+        
+        Parameters:
+        field - Field number (1-8) within the channel to set.
+        value - Floating point value (from -999999000000 to 999999000000) sampled.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if value is out of range or not a number
+        Code of -501 if the queue is full and the sample was dropped
+        
+        Notes:
+        writeFields() applies the queued samples as if addSample() had been called.
+        */
+        int queueSample(unsigned int field, float value)
+        {
+            if(isnan(value) || isinf(value) || !isFloatInRange(value)) return TS_ERR_OUT_OF_RANGE;
+            queuedValue queued;
+            queued.type = TS_VALUE_SAMPLES;
+            queued.floatValue = value;
+            return queueValue(field, queued);
+        }
+        #else
+        // Compiled out by TS_DISABLE_FLOAT, pass a long or a string instead
+        int queueField(unsigned int field, float value) = delete;
+        int queueField(unsigned int field, double value) = delete;
+        #endif
+        
+        
+        /*
+        Function: drainQueuedFields
+        
+        Summary:
+        Apply the values queued by queueField() and queueSample() to the multi-field update.
+        
+        Returns:
+        Number of values applied.
+        
+        Notes:
+        writeFields() calls this before it writes, call it directly to look at the staged values first.  Only call it from the thread that writes.
+        */
+        unsigned int drainQueuedFields()
+        {
+            unsigned int applied = 0;
+            queuedValue queued;
+            while(this->stagingQueue.pop(queued))
+            {
+                if(queued.type == TS_VALUE_LONG)
+                {
+                    setField(queued.field, queued.longValue);
                 }
-                if(t == 0x22 || t == 0x25 || t == 0x26 || t == 0x2B || t == 0x3B){
-                    n = n + 2;
+                #ifndef TS_DISABLE_FLOAT
+                else if(queued.type == TS_VALUE_FLOAT)
+                {
+                    setField(queued.field, queued.floatValue);
+                }
+                else
+                {
+                    addSample(queued.field, queued.floatValue);
                 }
+                #endif
+                applied++;
+            }
+            return applied;
+        }
+        
+        
+        /*
+        Function: getQueueDropCount
+        
+        Summary:
+        Get the number of values dropped by queueField() and queueSample() because the queue was full.
+        
+        Returns:
+        Number of values dropped since the library was created.
+        */
+        unsigned long getQueueDropCount()
+        {
+            return this->stagingQueue.getDropped();
+        }
+        
+
+        #ifndef TS_DISABLE_LOCATION
+        /*
+        Function: setLatitude
+        
+        Summary:
+        Set the latitude of a multi-field update.
+        
+        Parameters:
+        latitude - Latitude of the measurement as a floating point value (degrees N, use negative values for degrees S)
+        
+        Returns:
+        Always return 200
+        
+        Notes:
+        To record latitude, longitude and elevation of a write, call setField() for each of the fields you want to write. Then setLatitude(), setLongitude(), setElevation() and then call writeFields()
+        */
+        int setLatitude(float latitude)
+        {
+            TS_LOG_TRACE(TS_EVENT_SET_LOCATION, 0, isnan(latitude) ? 0 : latitude * 1000);
+            this->nextWriteLatitude = latitude;
+            return TS_OK_SUCCESS;
+        }
+        
+
+        /*
+        Function: setLongitude
+        
+        Summary:
+        Set the longitude of a multi-field update.
+        
+        Parameters:
+        longitude - Longitude of the measurement as a floating point value (degrees E, use negative values for degrees W)
+        
+        Returns:
+        Always return 200
+        
+        Notes:
+        To record latitude, longitude and elevation of a write, call setField() for each of the fields you want to write. Then setLatitude(), setLongitude(), setElevation() and then call writeFields()
+        */
+        int setLongitude(float longitude)
+        {
+            TS_LOG_TRACE(TS_EVENT_SET_LOCATION, 1, isnan(longitude) ? 0 : longitude * 1000);
+            this->nextWriteLongitude = longitude;
+            return TS_OK_SUCCESS;
+        }
+        
+
+        /*
+        Function: setElevation
+        
+        Summary:
+        Set the elevation of a multi-field update.
+        
+        Parameters:
+        elevation - Elevation of the measurement as a floating point value (meters above sea level)
+        
+        Returns:
+        Always return 200
+        
+        Notes:
+        To record latitude, longitude and elevation of a write, call setField() for each of the fields you want to write. Then setLatitude(), setLongitude(), setElevation() and then call writeFields()
+        */
+        int setElevation(float elevation)
+        {
+            TS_LOG_TRACE(TS_EVENT_SET_LOCATION, 2, isnan(elevation) ? 0 : elevation * 1000);
+            this->nextWriteElevation = elevation;
+            return TS_OK_SUCCESS;
+        }
+        #endif
+        
+        
+        #ifndef TS_DISABLE_STATUS
+        /*
+        Function: setStatus
+        
+        Summary:
+        Set the status field of a multi-field update.
+        
+        Parameters:
+        status - String to write (UTF8).  ThingSpeak limits this to 255 bytes.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if string is too long (> 255 bytes)
+        
+        Notes:
+        To record a status message on a write, call setStatus() then call writeFields().
+        Use status to provide additonal details when writing a channel update.
+        */
+        int setStatus(String status)
+        {
+            return setStatus(status.c_str());
+        }
+        
+        
+        /*
+        Function: setStatus
+        
+        Summary:
+        Set the status field of a multi-field update.
+        
+        Parameters:
+        status - Character array (zero terminated) to write (UTF8).  ThingSpeak limits this to 255 bytes.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if status is NULL or string is too long (> 255 bytes, or TS_COMPACT_STATUS_LENGTH when TS_COMPACT_STORAGE is defined)
+        */
+        int setStatus(const char * status)
+        {
+            if(NULL == status) return TS_ERR_OUT_OF_RANGE;
+            TS_LOG_TRACE(TS_EVENT_SET_STATUS, strlen(status), 0);
+            // Max # bytes for ThingSpeak field is 255 (UTF-8)
+            if(strlen(status) > TS_STATUS_VALUE_MAX) return TS_ERR_OUT_OF_RANGE;
+            this->nextWriteStatus = status;
+            return TS_OK_SUCCESS;
+        }       
+        #endif
+       
+        
+        /*
+        Function: setCreatedAt
+        
+        Summary:
+        Set the created-at date of a multi-field update.
+        
+        Parameters:
+        createdAt - Desired timestamp to be included with the channel update as a String.  The timestamp string must be in the ISO 8601 format. Example "2017-01-12 13:22:54"
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if string is too long (> 255 bytes)
+        
+        Notes:
+        Timezones can be set using the timezone hour offset parameter. For example, a timestamp for Eastern Standard Time is: "2017-01-12 13:22:54-05".
+        If no timezone hour offset parameter is used, UTC time is assumed.
+        */
+        int setCreatedAt(String createdAt)
+        {
+            return setCreatedAt(createdAt.c_str());
+        }
+        
+        
+        /*
+        Function: setCreatedAt
+        
+        Summary:
+        Set the created-at date of a multi-field update.
+        
+        Parameters:
+        createdAt - Desired timestamp to be included with the channel update as a character array (zero terminated).  The timestamp string must be in the ISO 8601 format. Example "2017-01-12 13:22:54"
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -101 if createdAt is NULL or string is too long (> 255 bytes, or TS_COMPACT_TIMESTAMP_LENGTH when TS_COMPACT_STORAGE is defined)
+        */
+        int setCreatedAt(const char * createdAt)
+        {
+            if(NULL == createdAt) return TS_ERR_OUT_OF_RANGE;
+            TS_LOG_TRACE(TS_EVENT_SET_CREATED_AT, strlen(createdAt), 0);
+            
+            // the ISO 8601 format is too complicated to check for valid timestamps here
+            // we'll need to reply on the api to tell us if there is a problem
+            // Max # bytes for ThingSpeak field is 255 (UTF-8)
+            if(strlen(createdAt) > TS_TIMESTAMP_VALUE_MAX) return TS_ERR_OUT_OF_RANGE;
+            this->nextWriteCreatedAt = createdAt;
+            
+            return TS_OK_SUCCESS;
+        }
+        
+        
+        /*
+        Function: setCreatedAtNow
+        
+        Summary:
+        Set the created-at date of a multi-field update to the current time.
+        
+        Returns:
+        Code of 200 if successful.
+        Code of -211 if the time is not known yet
+        
+        Notes:
+        Call this when the values are measured, so an update that is sent later, buffered or queued while offline, is stored at the time it was measured.  The time comes from getTime().
+        */
+        int setCreatedAtNow()
+        {
+            if(!this->clock.isValid())
+            {
+                return TS_ERR_TIME_UNKNOWN;
+            }
+            char timestamp[24];
+            formatUTCTimestamp(this->clock.now(), timestamp, sizeof(timestamp));
+            return setCreatedAt(timestamp);
+        }
+        
+        
+        /*
+        Function: getTime
+        
+        Summary:
+        Get the current UTC time known to the library.
+        
+        Returns:
+        UTC seconds since 1970, or 0 if the time is not known yet.
+        
+        Notes:
+        This is the device time when Time.isValid().  Otherwise it is kept from the Date header of the last response received from ThingSpeak, to within about a second, so devices without cloud time synchronization can stamp their updates without a separate time request.
+        */
+        unsigned long getTime()
+        {
+            return (unsigned long)this->clock.now();
+        }
+        
+        
+        /*
+        Function: writeFields
+        
+        Summary:
+        Write a multi-field update.
+        
+        Parameters:
+        channelNumber - Channel number
+        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        
+        Returns:
+        200 - successful.
+        202 - sent without waiting for the response, see setFireAndForget()
+        404 - Incorrect API key (or invalid ThingSpeak server address)
+        -101 - Value is out of range or string is too long (> 255 characters)
+        -201 - Invalid field number specified
+        -210 - setField() was not called before writeFields()
+        -301 - Failed to connect to ThingSpeak
+        -302 - Unexpected failure during write to ThingSpeak
+        -303 - Unable to parse response
+        -304 - Timeout waiting for server to respond
+        -401 - Point was not inserted (most probable cause is the rate limit of once every 15 seconds)
+        
+        
+        Notes:
+        Call setField(), setLatitude(), setLongitude(), setElevation() and/or setStatus() and then call writeFields()
+        */
+        int writeFields(unsigned long channelNumber, const char * writeAPIKey)
+        {
+            drainQueuedFields();
+            if(!hasStagedValues())
+            {
+                // setField was not called before writeFields
+                return TS_ERR_SETFIELD_NOT_CALLED;
+            }
+            if(this->idempotentWrites)
+            {
+                return writeIdempotentUpdate(channelNumber, writeAPIKey);
+            }
+            
+            // The staged values are formatted while the request body is sent
+            int status = writeUpdate(channelNumber, NULL, writeAPIKey, takeWritePriority());
+            resetWriteFields();
+            return status;
+        }
+
+        
+        /*
+        Function: writeRaw
+        
+        Summary:
+        Write a raw POST to a ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        postMessage - Raw URL to write to ThingSpeak as a string.  See the documentation at https://thingspeak.com/docs/channels#update_feed.
+        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        
+        Returns:
+        200 - successful.
+        202 - sent without waiting for the response, see setFireAndForget()
+        404 - Incorrect API key (or invalid ThingSpeak server address)
+        -101 - Value is out of range or string is too long (> 255 characters)
+        -201 - Invalid field number specified
+        -210 - setField() was not called before writeFields()
+        -301 - Failed to connect to ThingSpeak
+        -302 - Unexpected failure during write to ThingSpeak
+        -303 - Unable to parse response
+        -304 - Timeout waiting for server to respond
+        -401 - Point was not inserted (most probable cause is the rate limit of once every 15 seconds)
+        
+        Notes:
+        This is low level functionality that will not be required by most users.
+        */
+        int writeRaw(unsigned long channelNumber, String postMessage, const char * writeAPIKey)
+        {
+            TS_LOG_INFO(TS_EVENT_WRITE_RAW, channelNumber, postMessage.length());
+            
+            return writeUpdate(channelNumber, &postMessage, writeAPIKey, takeWritePriority());
+        }
+        
+        
+        /*
+        Function: setIdempotentWrites
+        
+        Summary:
+        Keep each multi-field update that may or may not have reached ThingSpeak, so it can be confirmed or resent without creating a duplicate.
+        
+        Parameters:
+        enable - true to keep updates after ambiguous failures (-302, -303 and -304)
+        
+        Notes:
+        While enabled, writeFields() sets the created-at timestamp of updates that do not have one to the current time (when it is known, see getTime()), so a resend is stored with the original time.  Only the most recent ambiguous update is kept.
+        */
+        void setIdempotentWrites(bool enable)
+        {
+            this->idempotentWrites = enable;
+            if(!enable)
+            {
+                clearPendingUpdate();
+            }
+        }
+        
+        
+        /*
+        Function: prepare
+        
+        Summary:
+        Connect to ThingSpeak ahead of the next read or write.
+        
+        Returns:
+        200 - the connection is open, or was already prepared
+        -301 - Failed to connect to ThingSpeak
+        -305 - Not tried, the circuit breaker is open
+        
+        Notes:
+        Call this before a slow step, like sampling sensors, so that the next read or write finds the connection open and sends its request right away.  connect() blocks, so the time is moved rather than hidden: prepare() takes the time connect() would have taken in the call.  A prepared connection not used within TS_PREPARE_IDLE_MS (10 seconds) is closed and opened again by the call that needs it.  While the worker thread is running, prepare() waits for the request it is sending.
+        */
+        int prepare()
+        {
+            #if PLATFORM_THREADING
+                std::lock_guard<RecursiveMutex> lock(this->networkLock);
+            #endif
+            reapWrite();
+            if(this->prepared && millis() - this->preparedAt < TS_PREPARE_IDLE_MS && this->client->connected())
+            {
+                return TS_OK_SUCCESS;
+            }
+            this->prepared = false;
+            int status = connectThingSpeak();
+            if(status == TS_OK_SUCCESS)
+            {
+                this->prepared = true;
+                this->preparedAt = millis();
+            }
+            return status;
+        }
+        
+        
+        /*
+        Function: setAutoPrepare
+        
+        Summary:
+        Let the worker thread prepare the connection for each write, a little before the write is due.
+        
+        Parameters:
+        writeIntervalMs - Time between writes of the sketch, 0 (the default) to turn this off
+        leadMs - How long before the next write is due to connect
+        
+        Notes:
+        The next write is expected writeIntervalMs after the previous one started.  Once it is due within leadMs, the worker thread calls prepare(), at most once per write, so the connection is open while the last samples are taken.  The setters never connect.  Without the worker this has no effect: call prepare() before the slow step instead.
+        */
+        void setAutoPrepare(unsigned long writeIntervalMs, unsigned long leadMs)
+        {
+            #if PLATFORM_THREADING
+                std::lock_guard<RecursiveMutex> lock(this->networkLock);
+            #endif
+            this->autoPrepareIntervalMs = writeIntervalMs;
+            this->autoPrepareLeadMs = leadMs;
+        }
+        
+        
+        /*
+        Function: setFireAndForget
+        
+        Summary:
+        Return from writes as soon as the request is sent, without waiting for the response.
+        
+        Parameters:
+        enable - true to send writes without waiting, false (the default) to wait for the entry ID
+        
+        Notes:
+        While enabled, writes return 202 once the request is sent, instead of waiting up to 5 seconds for the entry ID.  The connection is left open, and the next read or write takes the response if it has arrived by then, before reusing the client: the write counts as confirmed if ThingSpeak stored it, failed if it did not, and unconfirmed if no response had arrived.  Updates may be lost without an error, so use this for frequent telemetry where a missing point does not matter.  getLastEntryID() is 0 after a write that was not waited for.  Batches and reads always wait for their responses.
+        */
+        void setFireAndForget(bool enable)
+        {
+            this->fireAndForget = enable;
+        }
+        
+        
+        /*
+        Function: getConfirmedWrites
+        
+        Summary:
+        Get the number of writes sent by fire and forget that ThingSpeak later confirmed it stored.
+        */
+        unsigned long getConfirmedWrites()
+        {
+            return this->confirmedWrites;
+        }
+        
+        
+        /*
+        Function: getFailedWrites
+        
+        Summary:
+        Get the number of writes sent by fire and forget that ThingSpeak answered with an error, or did not store.
+        */
+        unsigned long getFailedWrites()
+        {
+            return this->failedWrites;
+        }
+        
+        
+        /*
+        Function: getUnconfirmedWrites
+        
+        Summary:
+        Get the number of writes sent by fire and forget whose response had not arrived by the next call.
+        */
+        unsigned long getUnconfirmedWrites()
+        {
+            return this->unconfirmedWrites;
+        }
+        
+        
+        /*
+        Function: getLastEntryID
+        
+        Summary:
+        Get the entry ID ThingSpeak gave the last write.
+        
+        Returns:
+        Entry ID, or 0 if the last write failed.
+        */
+        long getLastEntryID()
+        {
+            return this->lastEntryID;
+        }
+        
+        
+        /*
+        Function: getEntryHighWaterMark
+        
+        Summary:
+        Get the highest entry ID confirmed by ThingSpeak.
+        
+        Returns:
+        Entry ID, or 0 if no write has been confirmed.
+        
+        Notes:
+        Keep this in a retained variable or EEPROM and restore it with setEntryHighWaterMark() after a reset, so confirmDelivery() can tell new entries from old ones.
+        */
+        long getEntryHighWaterMark()
+        {
+            return this->entryHighWaterMark;
+        }
+        
+        
+        /*
+        Function: setEntryHighWaterMark
+        
+        Summary:
+        Restore the highest entry ID confirmed by ThingSpeak, saved from getEntryHighWaterMark().
+        
+        Parameters:
+        entryID - Entry ID
+        */
+        void setEntryHighWaterMark(long entryID)
+        {
+            this->entryHighWaterMark = entryID;
+        }
+        
+        
+        /*
+        Function: hasPendingUpdate
+        
+        Summary:
+        Check for an update kept by setIdempotentWrites() after an ambiguous failure.
+        
+        Returns:
+        true if an update is waiting for confirmDelivery() or resendPendingUpdate().
+        */
+        bool hasPendingUpdate()
+        {
+            return this->pendingUpdate.length() > 0;
+        }
+        
+        
+        #ifndef TS_DISABLE_READS
+        /*
+        Function: confirmDelivery
+        
+        Summary:
+        Check whether the pending update reached ThingSpeak by reading the latest entry of the channel, without sending the update again.
+        
+        Parameters:
+        channelNumber - Channel number
+        readAPIKey - Read API key associated with the channel, or NULL for a public channel.  *If you share code with others, do _not_ share this key*
+        
+        Returns:
+        200 - the update was stored, or there is no pending update.  getLastEntryID() is its entry ID.
+        -401 - the update was not stored, call resendPendingUpdate().
+        -405 - there is a newer entry, but it is not the update.  The update may be an earlier entry, or not stored.
+        Other values are errors reading the channel, see getLastReadStatus().
+        
+        Notes:
+        The latest entry matches if its entry ID is above the high-water mark and its created-at timestamp is the one sent.  An update sent without a timestamp, before the time was known, matches if every field it sent has the same value in the entry; an update with no fields then can't be matched.  Timestamps set with setCreatedAt() only match in the form ThingSpeak returns them, "YYYY-MM-DDTHH:MM:SSZ".
+        */
+        int confirmDelivery(unsigned long channelNumber, const char * readAPIKey)
+        {
+            if(!hasPendingUpdate())
+            {
+                return TS_OK_SUCCESS;
+            }
+            String content = readRaw(channelNumber, "/feeds/last.json", readAPIKey);
+            if(getLastReadStatus() != TS_OK_SUCCESS)
+            {
+                return getLastReadStatus();
+            }
+            
+            long entryID = getJSONNumberByKey(content, "entry_id");
+            if(entryID <= this->entryHighWaterMark)
+            {
+                return TS_ERR_NOT_INSERTED;
+            }
+            bool matched;
+            if(this->pendingCreatedAt.length() > 0)
+            {
+                matched = (getJSONValueByKey(content, "created_at") == String(this->pendingCreatedAt.c_str()));
+            }
+            else
+            {
+                matched = pendingFieldsMatch(content);
+            }
+            if(!matched)
+            {
+                return TS_ERR_UNCONFIRMED;
+            }
+            acknowledgeEntry(entryID);
+            clearPendingUpdate();
+            return TS_OK_SUCCESS;
+        }
+        #endif
+        
+        
+        /*
+        Function: resendPendingUpdate
+        
+        Summary:
+        Send the pending update again, with its original created-at timestamp.
+        
+        Parameters:
+        channelNumber - Channel number
+        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        
+        Returns:
+        Same values as writeFields(), or -210 if there is no pending update.
+        
+        Notes:
+        Call confirmDelivery() first, or the update may be stored twice.  The update stays pending until a resend succeeds.
+        */
+        int resendPendingUpdate(unsigned long channelNumber, const char * writeAPIKey)
+        {
+            if(!hasPendingUpdate())
+            {
+                return TS_ERR_SETFIELD_NOT_CALLED;
+            }
+            int status = writeUpdate(channelNumber, &this->pendingUpdate, writeAPIKey, takeWritePriority());
+            if(status == TS_OK_SUCCESS)
+            {
+                clearPendingUpdate();
+            }
+            return status;
+        }
+        
+        
+        #ifndef TS_DISABLE_READS
+        /*
+        Function: readStringField
+        
+        Summary:
+        Read the latest string from a private ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        field - Field number (1-8) within the channel to read from.
+        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        
+        Returns:
+        Value read (UTF8 string), or empty string if there is an error.  Use getLastReadStatus() to get more specific information.
+        */
+        String readStringField(unsigned long channelNumber, unsigned int field, const char * readAPIKey)
+        {
+            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX)
+            {
+                this->lastReadStatus = TS_ERR_INVALID_FIELD_NUM;
+                return("");
+            }
+            TS_LOG_INFO(TS_EVENT_READ_FIELD, channelNumber, field);
+            return readRaw(channelNumber, String(String("/fields/") + String(field) + String("/last")), readAPIKey);
+        }
+        
+
+        /*
+        Function: readStringField
+        
+        Summary:
+        Read the latest string from a private ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        field - Field number (1-8) within the channel to read from.
+        
+        Returns:
+        Value read (UTF8 string), or empty string if there is an error.  Use getLastReadStatus() to get more specific information.
+        */
+        String readStringField(unsigned long channelNumber, unsigned int field)
+        {
+            return readStringField(channelNumber, field, NULL);
+        }
+
+
+        /*
+        Function: readFloatField
+        
+        Summary:
+        ead the latest floating point value from a private ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        field - Field number (1-8) within the channel to read from.
+        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        
+        Returns:
+        Value read, or 0 if the field is text or there is an error.  Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
+        */
+        float readFloatField(unsigned long channelNumber, unsigned int field, const char * readAPIKey)
+        {
+            return convertStringToFloat(readStringField(channelNumber, field, readAPIKey));
+        }
+
+
+        /*
+        Function: readFloatField
+        
+        Summary:
+        Read the latest floating point value from a private ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        field - Field number (1-8) within the channel to read from.
+        
+        Returns:
+        Value read, or 0 if the field is text or there is an error.  Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
+        */
+        float readFloatField(unsigned long channelNumber, unsigned int field)
+        {
+            return readFloatField(channelNumber, field, NULL);
+        }
+
+
+        /*
+        Function: readLongField
+        
+        Summary:
+        Read the latest long value from a private ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        field - Field number (1-8) within the channel to read from.
+        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        
+        Returns:
+        Value read, or 0 if the field is text or there is an error.  Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
+        */
+        long readLongField(unsigned long channelNumber, unsigned int field, const char * readAPIKey)
+        {
+            // Note that although the function is called "toInt" it really returns a long.
+            return readStringField(channelNumber, field, readAPIKey).toInt();
+        }
+
+
+        /*
+        Function: readLongField
+        
+        Summary:
+        Read the latest long value from a private ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        field - Field number (1-8) within the channel to read from.
+        
+        Returns:
+        Value read, or 0 if the field is text or there is an error.  Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
+        */
+        long readLongField(unsigned long channelNumber, unsigned int field)
+        {
+            return readLongField(channelNumber, field, NULL);
+        }
+
+
+        /*
+        Function: readIntField
+        
+        Summary:
+        Read the latest int value from a private ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        field - Field number (1-8) within the channel to read from.
+        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        
+        Returns:
+        Value read, or 0 if the field is text or there is an error.  Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
+        */
+        int readIntField(unsigned long channelNumber, unsigned int field, const char * readAPIKey)
+        {
+            return readLongField(channelNumber, field, readAPIKey);
+        }
+
+
+        /*
+        Function: readIntField
+        
+        Summary:
+        Read the latest int value from a private ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        field - Field number (1-8) within the channel to read from.
+        
+        Returns:
+        Value read, or 0 if the field is text or there is an error.  Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
+        */
+        int readIntField(unsigned long channelNumber, unsigned int field)
+        {
+            return readLongField(channelNumber, field, NULL);
+        }
+        
+
+        /*
+        Function: readStatus
+        
+        Summary:
+        Read the latest status from a private ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        
+        Results:
+        Value read (UTF8 string). An empty string is returned if there was no status written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        */
+        String readStatus(unsigned long channelNumber, const char * readAPIKey)
+        {
+            String content = readRaw(channelNumber, "/feeds/last.txt?status=true", readAPIKey);
+            
+            if(getLastReadStatus() != TS_OK_SUCCESS){
+                return String("");
+            }
+            
+            return getJSONValueByKey(content, "status");
+        }
+        
+        
+        /*
+        Function: readStatus
+        
+        Summary:
+        Read the latest status from a private ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        
+        Results:
+        Value read (UTF8 string). An empty string is returned if there was no status written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        */
+        String readStatus(unsigned long channelNumber)
+        {
+            return readStatus(channelNumber, NULL);
+        }
+        
+        
+        /*
+        Function: readCreatedAt
+        
+        Summary:
+        Read the created-at timestamp associated with the latest update to a private ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        
+        Results:
+        Value read (UTF8 string). An empty string is returned if there was no created-at timestamp written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        */
+        String readCreatedAt(unsigned long channelNumber, const char * readAPIKey)
+        {
+            String content = readRaw(channelNumber, "/feeds/last.txt", readAPIKey);
+            
+            if(getLastReadStatus() != TS_OK_SUCCESS){
+                return String("");
+            }
+            
+            return getJSONValueByKey(content, "created_at");
+        }
+        
+
+        /*
+        Function: readCreatedAt
+        
+        Summary:
+        Read the created-at timestamp associated with the latest update to a private ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+            
+        Results:
+        Value read (UTF8 string). An empty string is returned if there was no created-at timestamp written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        */
+        String readCreatedAt(unsigned long channelNumber)
+        {
+            return readCreatedAt(channelNumber, NULL);
+        }
+        
+        
+        /*
+        Function: readRaw
+        
+        Summary:
+        Read a raw response from a public ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        URLSuffix - Raw URL to write to ThingSpeak as a String.  See the documentation at https://thingspeak.com/docs/channels#get_feed
+        readAPIKey - Read API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        
+        Returns:
+        Response if successful, or empty string. Use getLastReadStatus() to get more specific information.
+        
+        Notes:
+        This is low level functionality that will not be required by most users.
+        */
+        String readRaw(unsigned long channelNumber, String URLSuffix, const char * readAPIKey)
+        {
+            TS_LOG_INFO(TS_EVENT_READ_RAW, channelNumber, URLSuffix.length());
+            #if PLATFORM_THREADING
+                std::lock_guard<RecursiveMutex> lock(this->networkLock);
+            #endif
+
+            beginOperation();
+            reapWrite();
+            if(!checkDataBudget(false, TS_PRIORITY_NORMAL))
+            {
+                this->lastReadStatus = TS_ERR_BUDGET_EXCEEDED;
+                return String("");
+            }
+            int connectStatus = deadlinePassed() ? TS_ERR_DEADLINE_EXCEEDED : connectThingSpeak();
+            if(connectStatus != TS_OK_SUCCESS)
+            {
+                this->lastReadStatus = connectStatus;
+                return String("");
+            }
+            if(deadlinePassed())
+            {
+                // The connection used up the time, don't send a request there is no time to read the answer to
+                this->client->stop();
+                this->lastReadStatus = TS_ERR_DEADLINE_EXCEEDED;
+                return String("");
+            }
+
+            String URL = String("/channels/") + String(channelNumber) + URLSuffix;
+
+            // Post data to thingspeak
+            if(!this->client->print("GET ")) return abortReadRaw();
+            if(!this->client->print(URL)) return abortReadRaw();
+            if(!this->client->print(" HTTP/1.1\r\n")) return abortReadRaw();
+            if(!writeHTTPHeader(readAPIKey)) return abortReadRaw();
+            #ifdef TS_GZIP_RESPONSES
+                if(!this->client->print("Accept-Encoding: gzip\r\n")) return abortReadRaw();
+            #endif
+            if(NULL != this->requestETag && '\0' != this->requestETag[0])
+            {
+                if(!this->client->print("If-None-Match: ")) return abortReadRaw();
+                if(!this->client->print(this->requestETag)) return abortReadRaw();
+                if(!this->client->print("\r\n")) return abortReadRaw();
+            }
+            if(!this->client->print("\r\n")) return abortReadRaw();
+     
+            String content = String();
+            int status = getHTTPResponse(content);
+            this->lastReadStatus = status;
+            recordBreakerResult(status);
+
+            client->stop();
+            TS_LOG_TRACE(TS_EVENT_DISCONNECTED, 0, 0);
+
+            if(status != TS_OK_SUCCESS)
+            {
+                // return status;
+                return String("");
+            }
+
+            // This is a workaround to a bug in the Spark implementation of String
+            return String("") + content;
+        }
+        
+        
+        /*
+        Function: readRaw
+        
+        Summary:
+        Read a raw response from a public ThingSpeak channel
+        
+        Parameters:
+        channelNumber - Channel number
+        URLSuffix - Raw URL to write to ThingSpeak as a String.  See the documentation at https://thingspeak.com/docs/channels#get_feed
+        
+        Returns:
+        Response if successful, or empty string. Use getLastReadStatus() to get more specific information.
+        
+        Notes:
+        This is low level functionality that will not be required by most users.
+        */
+        String readRaw(unsigned long channelNumber, String URLSuffix)
+        {
+            return readRaw(channelNumber, URLSuffix, NULL);
+        }
+        
+        
+        /*
+        Function: readBatch
+        
+        Summary:
+        Read from several channels at once, over several connections.
+        
+        Parameters:
+        requests - Array of reads.  Set channelNumber, field or URLSuffix, and readAPIKey of each; status, response and elapsedMs are filled in.
+        requestCount - Number of reads
+        clients - Array of clients to read over, for example TCPClient objects created earlier in the sketch
+        clientCount - Number of clients, at most TS_READ_POOL_MAX are used
+        
+        Returns:
+        Number of reads that succeeded.
+        
+        Notes:
+        Each client connects and sends its request, then all the responses are read as they arrive, so the total time is close to the connection times plus the slowest response rather than the sum of all of them.  The response of each read is the same as readStringField() or readRaw() would return.
+        */
+        unsigned int readBatch(readRequest * requests, unsigned int requestCount, Client ** clients, unsigned int clientCount)
+        {
+            return runBatch(requests, requestCount, clients, clientCount);
+        }
+        #endif
+        
+        
+        /*
+        Function: beginChannelUpdate
+        
+        Summary:
+        Set up a channelUpdate for writeBatch().
+        
+        Parameters:
+        update - channelUpdate to set up, keep it from one cycle to the next
+        channelNumber - Channel number
+        writeAPIKey - Write API key associated with the channel.  Must stay valid while the update is used.  *If you share code with others, do _not_ share this key*
+        minIntervalMs - Shortest time between updates of the channel, TS_RATE_LIMIT_MS for a free account
+        */
+        void beginChannelUpdate(channelUpdate & update, unsigned long channelNumber, const char * writeAPIKey, unsigned long minIntervalMs)
+        {
+            update.channelNumber = channelNumber;
+            update.writeAPIKey = writeAPIKey;
+            update.minIntervalMs = minIntervalMs;
+            update.postMessage = "";
+            update.lastWriteAt = 0;
+            update.written = false;
+            update.status = TS_OK_SUCCESS;
+            update.entryID = 0;
+            update.elapsedMs = 0;
+        }
+        
+        
+        /*
+        Function: stageChannelUpdate
+        
+        Summary:
+        Move the multi-field update staged with setField(), setStatus() and the other set functions into a channelUpdate.
+        
+        Parameters:
+        update - channelUpdate set up by beginChannelUpdate()
+        
+        Returns:
+        200 - OK / Success
+        -210 - setField() was not called
+        
+        Notes:
+        The staged values are cleared, so the values for the next channel can be set right away.
+        */
+        int stageChannelUpdate(channelUpdate & update)
+        {
+            drainQueuedFields();
+            if(!hasStagedValues())
+            {
+                return TS_ERR_SETFIELD_NOT_CALLED;
+            }
+            update.postMessage = "";
+            ThingSpeakStringPrinter staged(update.postMessage);
+            printStagedValues(staged, isConservingData());
+            resetWriteFields();
+            return TS_OK_SUCCESS;
+        }
+        
+        
+        /*
+        Function: writeBatch
+        
+        Summary:
+        Write the staged updates of several channels at once, over several connections.
+        
+        Parameters:
+        updates - Array of channelUpdate, each set up by beginChannelUpdate().  Updates with no postMessage are skipped.
+        updateCount - Number of updates
+        clients - Array of clients to write over, for example TCPClient objects created earlier in the sketch
+        clientCount - Number of clients, at most TS_READ_POOL_MAX are used
+        
+        Returns:
+        Number of updates ThingSpeak accepted.
+        
+        Notes:
+        The status, entryID and elapsedMs of each update are filled in.  An update less than minIntervalMs after the last accepted update of its channel is not sent and gets status -402; it stays staged for the next call.  Accepted updates are cleared.
+        */
+        unsigned int writeBatch(channelUpdate * updates, unsigned int updateCount, Client ** clients, unsigned int clientCount)
+        {
+            return runBatch(updates, updateCount, clients, clientCount);
+        }
+        
+        
+        #ifndef TS_DISABLE_READS
+        /*
+        Function: readMultipleFields
+         
+        Summary:
+        Read all the field values, status message, location coordinates, and created-at timestamp associated with the latest feed to a private ThingSpeak channel and store the values locally in variables within a struct.
+         
+        Parameters:
+        channelNumber - Channel number
+        readAPIKey - Read API key associated with the channel. *If you share code with others, do _not_ share this key*
+         
+        Returns:
+        HTTP status code of 200 if successful.
+        
+        Notes:
+        See getLastReadStatus() for other possible return values.
+        */
+        int readMultipleFields(unsigned long channelNumber, const char * readAPIKey)
+        {
+            String readCondition = "/feeds/last.txt?status=true&location=true";
+            
+            String multiContent = readRaw(channelNumber, readCondition, readAPIKey);
+            
+            if(getLastReadStatus() != TS_OK_SUCCESS){
+                return getLastReadStatus();
+            }
+            
+            // The values are parsed when they are fetched
+            storeLastFeed(multiContent, TS_FEED_FORMAT_JSON, TS_FEED_ALL_VALUES);
+            
+            return TS_OK_SUCCESS;
+        }
+        
+        
+        /*
+        Function: readMultipleFields
+        
+        Summary:
+        Read all the field values, status message, location coordinates, and created-at timestamp associated with the latest update to a private ThingSpeak channel and store the values locally in variables within a struct.
+         
+        Parameters:
+        channelNumber - Channel number
+        readAPIKey - Read API key associated with the channel. *If you share code with others, do _not_ share this key*
+         
+        Returns:
+        HTTP status code of 200 if successful.
+        
+        Notes:
+        See getLastReadStatus() for other possible return values.
+        */
+        int readMultipleFields(unsigned long channelNumber)
+        {
+            return readMultipleFields(channelNumber, NULL);
+        }
+        
+        
+        /*
+        Function: readSelectedFields
+         
+        Summary:
+        Read only the selected field values (and optionally the status message and location coordinates) associated with the latest feed to a private ThingSpeak channel and store the values locally in variables within a struct.
+         
+        Parameters:
+        channelNumber - Channel number
+        selection - Bitmask of the values to read.  Combine TS_SELECT_FIELD(field) for each field (1-8) with TS_SELECT_STATUS and/or TS_SELECT_LOCATION.
+        readAPIKey - Read API key associated with the channel. *If you share code with others, do _not_ share this key*
+         
+        Returns:
+        HTTP status code of 200 if successful.
+        -201 - No field, status or location was selected
+        
+        Notes:
+        The smallest response format is requested for the selection: a single field is read as plain text, anything else as CSV, and status and location are only requested when selected.
+        ThingSpeak has no request for some of the fields of an entry, so a selection of two or more fields downloads all eight from /feeds/last.csv and only keeps the selected ones.  Only a single field on its own, and leaving out the status and location, make the response smaller.
+        Values that were not selected are cleared, so getFieldAsString(), getStatus(), etc. return an empty string for them.  The created-at timestamp is not available when a single field is read.
+        See getLastReadStatus() for other possible return values.
+        */
+        int readSelectedFields(unsigned long channelNumber, unsigned int selection, const char * readAPIKey)
+        {
+            unsigned int fieldMask = selection & TS_SELECT_ALL_FIELDS;
+            if(0 == (selection & (TS_SELECT_ALL_FIELDS | TS_SELECT_STATUS | TS_SELECT_LOCATION)))
+            {
+                this->lastReadStatus = TS_ERR_INVALID_FIELD_NUM;
+                return TS_ERR_INVALID_FIELD_NUM;
+            }
+            
+            TS_LOG_INFO(TS_EVENT_READ_SELECTED, channelNumber, selection);
+            
+            // A single field with no status or location is cheapest to read as the bare value
+            if(selection == fieldMask && 0 == (fieldMask & (fieldMask - 1)))
+            {
+                unsigned int field = FIELDNUM_MIN;
+                while(0 == (fieldMask & TS_SELECT_FIELD(field)))
+                {
+                    field++;
+                }
+                
+                String value = readRaw(channelNumber, String("/fields/") + String(field) + String("/last"), readAPIKey);
+                
+                if(getLastReadStatus() != TS_OK_SUCCESS){
+                    return getLastReadStatus();
+                }
+                
+                storeLastFeed(value, TS_FEED_FORMAT_VALUE, TS_SELECT_FIELD(field));
+                return TS_OK_SUCCESS;
+            }
+            
+            String readCondition = "/feeds/last.csv";
+            if(selection & TS_SELECT_STATUS)
+            {
+                readCondition = readCondition + String("?status=true");
+            }
+            if(selection & TS_SELECT_LOCATION)
+            {
+                readCondition = readCondition + String((selection & TS_SELECT_STATUS) ? "&" : "?") + String("location=true");
+            }
+            
+            String csvContent = readRaw(channelNumber, readCondition, readAPIKey);
+            
+            if(getLastReadStatus() != TS_OK_SUCCESS){
+                return getLastReadStatus();
+            }
+            
+            if(csvContent.indexOf('\n') == -1)
+            {
+                // There is no record after the header
+                this->lastReadStatus = TS_ERR_BAD_RESPONSE;
+                return TS_ERR_BAD_RESPONSE;
+            }
+            
+            storeLastFeed(csvContent, TS_FEED_FORMAT_CSV, (selection & TS_FEED_ALL_VALUES) | TS_SELECT_CREATED_AT);
+            return TS_OK_SUCCESS;
+        }
+        
+        
+        /*
+        Function: readSelectedFields
+         
+        Summary:
+        Read only the selected field values (and optionally the status message and location coordinates) associated with the latest feed to a public ThingSpeak channel and store the values locally in variables within a struct.
+         
+        Parameters:
+        channelNumber - Channel number
+        selection - Bitmask of the values to read.  Combine TS_SELECT_FIELD(field) for each field (1-8) with TS_SELECT_STATUS and/or TS_SELECT_LOCATION.
+         
+        Returns:
+        HTTP status code of 200 if successful.
+        
+        Notes:
+        See getLastReadStatus() for other possible return values.
+        */
+        int readSelectedFields(unsigned long channelNumber, unsigned int selection)
+        {
+            return readSelectedFields(channelNumber, selection, NULL);
+        }
+        
+        
+        /*
+        Function: beginPoll
+        
+        Summary:
+        Set up a pollState to watch a channel for new entries with poll().
+        
+        Parameters:
+        state - pollState to set up
+        channelNumber - Channel number
+        selection - Values to keep when there is a new entry, the same TS_SELECT_* values as readSelectedFields()
+        readAPIKey - Read API key associated with the channel, or NULL for a public channel.  Must stay valid while polling.
+        
+        Returns:
+        200 - OK / Success
+        -201 - Invalid field number specified (nothing selected)
+        */
+        int beginPoll(pollState & state, unsigned long channelNumber, unsigned int selection, const char * readAPIKey)
+        {
+            if(0 == (selection & (TS_SELECT_ALL_FIELDS | TS_SELECT_STATUS | TS_SELECT_LOCATION)))
+            {
+                return TS_ERR_INVALID_FIELD_NUM;
+            }
+            state.channelNumber = channelNumber;
+            state.selection = selection;
+            state.readAPIKey = readAPIKey;
+            state.lastEntryID = 0;
+            state.etag[0] = '\0';
+            state.probes = 0;
+            state.changes = 0;
+            return TS_OK_SUCCESS;
+        }
+        
+        
+        /*
+        Function: poll
+        
+        Summary:
+        Check a channel for a new entry, and keep its values only if there is one.
+        
+        Parameters:
+        state - pollState set up by beginPoll()
+        callback - Optional function called when there is a new entry
+        context - Passed to the callback
+        
+        Returns:
+        200 - There is a new entry.  Use the readMultipleFields() helper functions, such as getFieldAsString(), to get its values.
+        304 - The channel has not changed
+        Other values are read errors, see getLastReadStatus().
+        
+        Notes:
+        Each poll probes the channel with feeds.json?results=0, which returns the channel header with its last entry ID and no entries, and reads the latest entry only when that ID has changed.  When a single field is selected, its latest entry is smaller than the header, so it is read directly as the probe.  If the server sent an ETag it is sent back as If-None-Match, so an unchanged channel can be answered without a body.
+        */
+        int poll(pollState & state, ThingSpeakChangeCallback callback, void * context)
+        {
+            unsigned int fieldMask = state.selection & TS_SELECT_ALL_FIELDS;
+            bool singleField = (state.selection == fieldMask && 0 == (fieldMask & (fieldMask - 1)));
+            String URLSuffix;
+            uint16_t selected;
+            if(singleField)
+            {
+                unsigned int field = FIELDNUM_MIN;
+                while(0 == (fieldMask & TS_SELECT_FIELD(field)))
+                {
+                    field++;
+                }
+                URLSuffix = String("/fields/") + String(field) + String("/last.json");
+                selected = TS_SELECT_FIELD(field) | TS_SELECT_CREATED_AT;
+            }
+            else
+            {
+                URLSuffix = "/feeds/last.json";
+                if(state.selection & TS_SELECT_STATUS)
+                {
+                    URLSuffix = URLSuffix + String("?status=true");
+                }
+                if(state.selection & TS_SELECT_LOCATION)
+                {
+                    URLSuffix = URLSuffix + String((state.selection & TS_SELECT_STATUS) ? "&" : "?") + String("location=true");
+                }
+                selected = (state.selection & TS_FEED_ALL_VALUES) | TS_SELECT_CREATED_AT;
+            }
+            
+            // The last entry of a single field is smaller than the channel header a probe returns, so it is its own probe
+            this->requestETag = state.etag;
+            this->responseETag = state.etag;
+            String content = readRaw(state.channelNumber, singleField ? URLSuffix : String("/feeds.json?results=0"), state.readAPIKey);
+            this->requestETag = NULL;
+            this->responseETag = NULL;
+            state.probes++;
+            
+            if(getLastReadStatus() != TS_OK_SUCCESS)
+            {
+                return getLastReadStatus();
+            }
+            
+            // Any other entry ID is new, including a lower one after the channel was cleared
+            long entryID = getJSONNumberByKey(content, singleField ? "entry_id" : "last_entry_id");
+            if(entryID <= 0 || entryID == state.lastEntryID)
+            {
+                return TS_OK_NOT_MODIFIED;
+            }
+            if(!singleField)
+            {
+                content = readRaw(state.channelNumber, URLSuffix, state.readAPIKey);
+                if(getLastReadStatus() != TS_OK_SUCCESS)
+                {
+                    // Without the ETag of the probe, the next poll sees the same change again
+                    state.etag[0] = '\0';
+                    return getLastReadStatus();
+                }
+                // The channel may have had another entry since the probe
+                long readEntryID = getJSONNumberByKey(content, "entry_id");
+                if(readEntryID > 0)
+                {
+                    entryID = readEntryID;
+                }
+            }
+            state.lastEntryID = entryID;
+            state.changes++;
+            storeLastFeed(content, TS_FEED_FORMAT_JSON, selected);
+            if(NULL != callback)
+            {
+                callback(state.channelNumber, entryID, context);
+            }
+            return TS_OK_SUCCESS;
+        }
+        
+        
+        /*
+        Function: readAggregatedSeries
+         
+        Summary:
+        Read a series of values from the history of a private ThingSpeak channel, aggregated by ThingSpeak before it is sent.
+         
+        Parameters:
+        channelNumber - Channel number
+        query - ThingSpeakQuery describing the field, aggregation and time range to read.
+        values - Array to store the values in, oldest first.  Periods without a value are skipped.
+        maxValues - Number of elements in the values array.  When the server returns more, the most recent values are kept.
+        count - Set to the number of values stored.
+        readAPIKey - Read API key associated with the channel. *If you share code with others, do _not_ share this key*
+         
+        Returns:
+        HTTP status code of 200 if successful.
+        -101 - The query uses an unsupported period, more than one aggregation, or too many results
+        -201 - Invalid field number specified
+        
+        Notes:
+        See getLastReadStatus() for other possible return values.
+        */
+        int readAggregatedSeries(unsigned long channelNumber, const ThingSpeakQuery & query, float * values, unsigned int maxValues, unsigned int & count, const char * readAPIKey)
+        {
+            count = 0;
+            if(query.getField() < FIELDNUM_MIN || query.getField() > FIELDNUM_MAX)
+            {
+                this->lastReadStatus = TS_ERR_INVALID_FIELD_NUM;
+                return TS_ERR_INVALID_FIELD_NUM;
+            }
+            if(!query.isValid() || NULL == values || 0 == maxValues)
+            {
+                this->lastReadStatus = TS_ERR_OUT_OF_RANGE;
+                return TS_ERR_OUT_OF_RANGE;
+            }
+            
+            String csvContent = readRaw(channelNumber, query.getURLSuffix(), readAPIKey);
+            
+            if(getLastReadStatus() != TS_OK_SUCCESS){
+                return getLastReadStatus();
+            }
+            
+            count = parseCSVSeries(csvContent, query.getField(), values, maxValues);
+            return TS_OK_SUCCESS;
+        }
+        
+        
+        /*
+        Function: readAggregatedSeries
+         
+        Summary:
+        Read a series of values from the history of a public ThingSpeak channel, aggregated by ThingSpeak before it is sent.
+         
+        Parameters:
+        channelNumber - Channel number
+        query - ThingSpeakQuery describing the field, aggregation and time range to read.
+        values - Array to store the values in, oldest first.  Periods without a value are skipped.
+        maxValues - Number of elements in the values array.  When the server returns more, the most recent values are kept.
+        count - Set to the number of values stored.
+         
+        Returns:
+        HTTP status code of 200 if successful.
+        
+        Notes:
+        See getLastReadStatus() for other possible return values.
+        */
+        int readAggregatedSeries(unsigned long channelNumber, const ThingSpeakQuery & query, float * values, unsigned int maxValues, unsigned int & count)
+        {
+            return readAggregatedSeries(channelNumber, query, values, maxValues, count, NULL);
+        }
+        
+        
+        /*
+        Function: readAggregatedStatistic
+         
+        Summary:
+        Read a single statistic over the history of a private ThingSpeak channel, aggregated by ThingSpeak before it is sent.
+         
+        Parameters:
+        channelNumber - Channel number
+        query - ThingSpeakQuery describing the field, aggregation and time range to read.
+        reduction - How the aggregated periods are combined: TS_REDUCE_MEAN, TS_REDUCE_MIN, TS_REDUCE_MAX, TS_REDUCE_SUM or TS_REDUCE_LAST.
+        readAPIKey - Read API key associated with the channel. *If you share code with others, do _not_ share this key*
+         
+        Returns:
+        Value of the statistic, or NAN if there is an error or no values in the range.  Use getLastReadStatus() to get more specific information, -101 if the reduction is not one of the above, checked before anything is read.
+        
+        Notes:
+        Choose a period at least as long as the time range so ThingSpeak returns only one or two values, for example ThingSpeakQuery(1).average(TS_PERIOD_HOURLY).lastMinutes(60).
+        The server returns one value per period, so TS_REDUCE_MEAN is the mean of the period averages and TS_REDUCE_MAX is the largest period value.
+        */
+        float readAggregatedStatistic(unsigned long channelNumber, const ThingSpeakQuery & query, unsigned int reduction, const char * readAPIKey)
+        {
+            // TS_REDUCE_MINMAX_STATUS only applies to addSample()
+            if(reduction > TS_REDUCE_LAST)
+            {
+                this->lastReadStatus = TS_ERR_OUT_OF_RANGE;
+                return NAN;
+            }
+            float values[TS_STATISTIC_PERIODS_MAX];
+            unsigned int count = 0;
+            if(readAggregatedSeries(channelNumber, query, values, TS_STATISTIC_PERIODS_MAX, count, readAPIKey) != TS_OK_SUCCESS || count == 0)
+            {
+                return NAN;
+            }
+            
+            float result = values[0];
+            float total = values[0];
+            for(unsigned int iValue = 1; iValue < count; iValue++)
+            {
+                total += values[iValue];
+                if(values[iValue] < result && reduction == TS_REDUCE_MIN) result = values[iValue];
+                if(values[iValue] > result && reduction == TS_REDUCE_MAX) result = values[iValue];
+            }
+            
+            switch(reduction)
+            {
+                case TS_REDUCE_MEAN:
+                    return total / count;
+                case TS_REDUCE_SUM:
+                    return total;
+                case TS_REDUCE_LAST:
+                    return values[count - 1];
+                case TS_REDUCE_MIN:
+                case TS_REDUCE_MAX:
+                default:
+                    return result;
+            }
+        }
+        
+        
+        /*
+        Function: readAggregatedStatistic
+         
+        Summary:
+        Read a single statistic over the history of a public ThingSpeak channel, aggregated by ThingSpeak before it is sent.
+         
+        Parameters:
+        channelNumber - Channel number
+        query - ThingSpeakQuery describing the field, aggregation and time range to read.
+        reduction - How the aggregated periods are combined: TS_REDUCE_MEAN, TS_REDUCE_MIN, TS_REDUCE_MAX, TS_REDUCE_SUM or TS_REDUCE_LAST.
+         
+        Returns:
+        Value of the statistic, or NAN if there is an error or no values in the range.  Use getLastReadStatus() to get more specific information.
+        */
+        float readAggregatedStatistic(unsigned long channelNumber, const ThingSpeakQuery & query, unsigned int reduction)
+        {
+            return readAggregatedStatistic(channelNumber, query, reduction, NULL);
+        }
+        
+        
+        /*
+        Function: getFieldAsString
+         
+        Summary:
+        Fetch the value as string from the latest stored feed record.
+        
+        Parameters:
+        field - Field number (1-8) within the channel to read from.
+        
+        Returns:
+        Value read (UTF8 string), empty string if there is an error, or old value read (UTF8 string) if invoked before readMultipleFields().  Use getLastReadStatus() to get more specific information.
+        */
+        String getFieldAsString(unsigned int field)
+        {
+            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX)
+            {
+                this->lastReadStatus = TS_ERR_INVALID_FIELD_NUM;
+                return("");
+            }
+            
+            this->lastReadStatus = TS_OK_SUCCESS;
+            return String(getFeedValue(field - 1));
+        }
+        
+        
+        /*
+        Function: getFieldAsFloat
+         
+        Summary:
+        Fetch the value as float from the latest stored feed record.
+        
+        Parameters:
+        field - Field number (1-8) within the channel to read from.
+        
+        Returns:
+        Value read, 0 if the field is text or there is an error, or old value read if invoked before readMultipleFields(). Use getLastReadStatus() to get more specific information.  Note that NAN, INFINITY, and -INFINITY are valid results.
+        */
+        float getFieldAsFloat(unsigned int field)
+        {
+            return convertCharArrayToFloat(getFieldAsCharArray(field));
+        }
+        
+        
+        /*
+        Function: getFieldAsLong
+        
+        Summary:
+        Fetch the value as long from the latest stored feed record.
+        
+        Parameters:
+        field - Field number (1-8) within the channel to read from.
+        
+        Returns:
+        Value read, 0 if the field is text or there is an error, or old value read if invoked before readMultipleFields(). Use getLastReadStatus() to get more specific information.
+        */
+        long getFieldAsLong(unsigned int field)
+        {
+            return atol(getFieldAsCharArray(field));
+        }
+        
+        
+        /*
+        Function: getFieldAsInt
+         
+        Summary:
+        Fetch the value as int from the latest stored feed record.
+        
+        Parameters:
+        field - Field number (1-8) within the channel to read from.
+        
+        Returns:
+        Value read, 0 if the field is text or there is an error, or old value read if invoked before readMultipleFields(). Use getLastReadStatus() to get more specific information.
+        */
+        int getFieldAsInt(unsigned int field)
+        {
+            // int and long are same
+            return getFieldAsLong(field);
+        }
+        
+        
+        /*
+        Function: getStatus
+         
+        Summary:
+        Fetch the status message associated with the latest stored feed record.
+        
+        Results:
+        Value read (UTF8 string). An empty string is returned if there was no status written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        */
+        String getStatus()
+        {
+            return String(getFeedValue(TS_FEED_STATUS));
+        }
+        
+        
+        /*
+        Function: getLatitude
+         
+        Summary:
+        Fetch the latitude associated with the latest stored feed record.
+        
+        Results:
+        Value read (UTF8 string). An empty string is returned if there was no latitude written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        */
+        String getLatitude()
+        {
+            return String(getFeedValue(TS_FEED_LATITUDE));
+        }
+        
+        
+        /*
+        Function: getLongitude
+         
+        Summary:
+        Fetch the longitude associated with the latest stored feed record.
+        
+        Results:
+        Value read (UTF8 string). An empty string is returned if there was no longitude written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        */
+        String getLongitude()
+        {
+            return String(getFeedValue(TS_FEED_LONGITUDE));
+        }
+        
+        
+        /*
+        Function: getElevation
+         
+        Summary:
+        Fetch the longitude associated with the latest stored feed record.
+        
+        Results:
+        Value read (UTF8 string). An empty string is returned if there was no elevation written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        */
+        String getElevation()
+        {
+            return String(getFeedValue(TS_FEED_ELEVATION));
+        }
+        
+        
+        /*
+        Function: getCreatedAt
+         
+        Summary:
+        Fetch the created-at timestamp associated with the latest stored feed record.
+        
+        Results:
+        Value read (UTF8 string). An empty string is returned if there was no created-at timestamp written to the channel or in case of an error.  Use getLastReadStatus() to get more specific information.
+        */
+        String getCreatedAt()
+        {
+            return String(getFeedValue(TS_FEED_CREATED_AT));
+        }
+        
+        
+        /*
+        Function: getFieldAsCharArray
+         
+        Summary:
+        Fetch the value as a character array from the latest stored feed record, without copying it.
+        
+        Parameters:
+        field - Field number (1-8) within the channel to read from.
+        
+        Returns:
+        Value read (UTF8, zero terminated), empty if there is an error, or old value read if invoked before readMultipleFields().  Use getLastReadStatus() to get more specific information.
+        
+        Notes:
+        The characters belong to the library and are only valid until the next read.
+        */
+        const char * getFieldAsCharArray(unsigned int field)
+        {
+            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX)
+            {
+                this->lastReadStatus = TS_ERR_INVALID_FIELD_NUM;
+                return "";
+            }
+            
+            this->lastReadStatus = TS_OK_SUCCESS;
+            return getFeedValue(field - 1);
+        }
+        
+        
+        /*
+        Function: getStatusAsCharArray
+         
+        Summary:
+        Fetch the status message associated with the latest stored feed record, without copying it.
+        
+        Results:
+        Value read (UTF8, zero terminated). The characters belong to the library and are only valid until the next read.
+        */
+        const char * getStatusAsCharArray()
+        {
+            return getFeedValue(TS_FEED_STATUS);
+        }
+        
+        
+        /*
+        Function: getLatitudeAsCharArray
+         
+        Summary:
+        Fetch the latitude associated with the latest stored feed record, without copying it.
+        
+        Results:
+        Value read (zero terminated). The characters belong to the library and are only valid until the next read.
+        */
+        const char * getLatitudeAsCharArray()
+        {
+            return getFeedValue(TS_FEED_LATITUDE);
+        }
+        
+        
+        /*
+        Function: getLongitudeAsCharArray
+         
+        Summary:
+        Fetch the longitude associated with the latest stored feed record, without copying it.
+        
+        Results:
+        Value read (zero terminated). The characters belong to the library and are only valid until the next read.
+        */
+        const char * getLongitudeAsCharArray()
+        {
+            return getFeedValue(TS_FEED_LONGITUDE);
+        }
+        
+        
+        /*
+        Function: getElevationAsCharArray
+         
+        Summary:
+        Fetch the elevation associated with the latest stored feed record, without copying it.
+        
+        Results:
+        Value read (zero terminated). The characters belong to the library and are only valid until the next read.
+        */
+        const char * getElevationAsCharArray()
+        {
+            return getFeedValue(TS_FEED_ELEVATION);
+        }
+        
+        
+        /*
+        Function: getCreatedAtAsCharArray
+         
+        Summary:
+        Fetch the created-at timestamp associated with the latest stored feed record, without copying it.
+        
+        Results:
+        Value read (zero terminated). The characters belong to the library and are only valid until the next read.
+        */
+        const char * getCreatedAtAsCharArray()
+        {
+            return getFeedValue(TS_FEED_CREATED_AT);
+        }
+        #endif
+        
+        
+        /*
+        Function: getLastReadStatus
+        
+        Summary:
+        Get the status of the previous read.
+        
+        Returns:
+        Generally, these are HTTP status codes.  Negative values indicate an error generated by the library.
+        Possible response codes...
+        200 - OK / Success
+        404 - Incorrect API key (or invalid ThingSpeak server address)
+        -101 - Value is out of range or string is too long (> 255 characters)
+        -201 - Invalid field number specified
+        -210 - setField() was not called before writeFields()
+        -301 - Failed to connect to ThingSpeak
+        -302 -  Unexpected failure during write to ThingSpeak
+        -303 - Unable to parse response
+        -304 - Timeout waiting for server to respond
+        -305 - Not sent, the circuit breaker is open
+        -306 - The deadline passed before the read finished
+        -307 - Not enough free heap to decode a compressed response
+        -401 - Point was not inserted (most probable cause is exceeding the rate limit)
+        
+        Notes:
+        The read functions will return zero or empty if there is an error.  Use this function to retrieve the details.
+        */
+        int getLastReadStatus()
+        {
+            return this->lastReadStatus;
+        }
+        
+        
+        /*
+        Function: setCircuitBreaker
+        
+        Summary:
+        Configure the circuit breaker that stops requests while ThingSpeak is unreachable.
+        
+        Parameters:
+        threshold - Consecutive connect failures or timeouts that open the breaker, 0 to never open it
+        backoffMs - Time the breaker stays open before one probe request is let through
+        maxBackoffMs - Longest time between probes, the time doubles after each failed probe
+        
+        Notes:
+        While the breaker is open, reads, writes and batches return -305 immediately without using the network.  The first request after the backoff is sent as a probe; if the server answers the breaker closes, otherwise it opens again.  The breaker starts closed, and is reset by this function and when the port changes.
+        */
+        void setCircuitBreaker(unsigned int threshold, unsigned long backoffMs, unsigned long maxBackoffMs)
+        {
+            this->breaker.configure(threshold, backoffMs, maxBackoffMs);
+        }
+        
+        
+        /*
+        Function: getCircuitState
+        
+        Summary:
+        Get the state of the circuit breaker.
+        
+        Returns:
+        TS_BREAKER_CLOSED (0) when requests are sent, TS_BREAKER_OPEN (1) when they fail with -305, or TS_BREAKER_HALF_OPEN (2) while a probe is being sent.
+        */
+        uint8_t getCircuitState()
+        {
+            return this->breaker.getState();
+        }
+        
+        
+        /*
+        Function: getCircuitRetryIn
+        
+        Summary:
+        Get the time until an open circuit breaker lets a probe request through.
+        
+        Returns:
+        Milliseconds until the next probe, 0 if the breaker is not open or a request now would be the probe.
+        */
+        unsigned long getCircuitRetryIn()
+        {
+            return this->breaker.getRetryIn();
+        }
+        
+        
+        /*
+        Function: resetCircuitBreaker
+        
+        Summary:
+        Close the circuit breaker, for example when the network connection has been restored.
+        */
+        void resetCircuitBreaker()
+        {
+            this->breaker.reset();
+        }
+        
+        
+        /*
+        Function: setDataBudget
+        
+        Summary:
+        Set a budget for the data used by requests, which the library keeps to by sending less as it is used up.
+        
+        Parameters:
+        limitBytes - Bytes allowed in each period, 0 for no budget
+        period - TS_BUDGET_DAILY or TS_BUDGET_MONTHLY, periods start at midnight UTC and on the first of the month
+        conserveIntervalMs - Shortest time between writes once TS_BUDGET_CONSERVE_PERCENT of the budget is used
+        
+        Notes:
+        Every byte of each HTTP request and response is counted, TCP/IP and TLS overhead is not.  Once TS_BUDGET_CONSERVE_PERCENT (75) of the budget is used, writes are spaced out to conserveIntervalMs, fields set to TS_PRIORITY_BULK with setFieldPriority() are left out, and asynchronous writes are sent as bulk.  Once TS_BUDGET_RESERVE_PERCENT (95) is used, only critical writes are sent.  Requests that are held back return -403.  A new period starts only while the time is known, see getTime().
+        */
+        void setDataBudget(unsigned long limitBytes, uint8_t period, unsigned long conserveIntervalMs)
+        {
+            this->dataBudget.configure(limitBytes, period, conserveIntervalMs);
+        }
+        
+        
+        /*
+        Function: getDataBudgetLevel
+        
+        Summary:
+        Get how much the data budget governor is holding back.
+        
+        Returns:
+        TS_BUDGET_NORMAL (0), TS_BUDGET_CONSERVE (1) or TS_BUDGET_RESERVE (2).
+        */
+        uint8_t getDataBudgetLevel()
+        {
+            return this->dataBudget.getLevel();
+        }
+        
+        
+        /*
+        Function: getDataBudgetUsed
+        
+        Summary:
+        Get the bytes used by requests in the current budget period.
+        
+        Returns:
+        Bytes sent and received.
+        
+        Notes:
+        Keep the value in retained memory and restore it with setDataBudgetUsed() after a reset, so a reset does not start the budget over.
+        */
+        unsigned long getDataBudgetUsed()
+        {
+            return this->dataBudget.getUsed();
+        }
+        
+        
+        /*
+        Function: setDataBudgetUsed
+        
+        Summary:
+        Restore the bytes used in the current budget period.
+        
+        Parameters:
+        usedBytes - Bytes used, as returned by getDataBudgetUsed()
+        */
+        void setDataBudgetUsed(unsigned long usedBytes)
+        {
+            this->dataBudget.setUsed(usedBytes);
+        }
+        
+        
+        /*
+        Function: getDataBudgetRemaining
+        
+        Summary:
+        Get the bytes left in the current budget period.
+        
+        Returns:
+        Bytes left, 0 if the budget is used up or no budget is set.
+        */
+        unsigned long getDataBudgetRemaining()
+        {
+            unsigned long used = this->dataBudget.getUsed();
+            return (used < this->dataBudget.getLimit()) ? this->dataBudget.getLimit() - used : 0;
+        }
+        
+        
+        /*
+        Function: getLastRequestBytes
+        
+        Summary:
+        Get the bytes sent and received by the last request made with the client given to begin().
+        
+        Returns:
+        HTTP bytes of the request and its response.
+        
+        Notes:
+        readBatch() and writeBatch() give the bytes of each of their requests in its `bytes` member.
+        */
+        unsigned long getLastRequestBytes()
+        {
+            return this->meteredClient.getRequestBytes();
+        }
+        
+        
+        /*
+        Function: getBytesSent
+        
+        Summary:
+        Get the HTTP bytes sent since startup, and with getBytesReceived() the bytes received.
+        */
+        unsigned long long getBytesSent()
+        {
+            return this->dataBudget.getBytesSent();
+        }
+        
+        unsigned long long getBytesReceived()
+        {
+            return this->dataBudget.getBytesReceived();
+        }
+        
+        
+#if TS_LOG_LEVEL > TS_LOG_LEVEL_NONE
+        /*
+        Function: dumpLog
+        
+        Summary:
+        Print the events logged since the last dumpLog() or drainLog(), oldest first, one per line.
+        
+        Parameters:
+        out - Where to print, for example Serial
+        
+        Returns:
+        Number of characters printed.
+        
+        Notes:
+        Only available when TS_LOG_LEVEL is above TS_LOG_LEVEL_NONE.  Each line is the time in milliseconds, the record number, the level, the event, and its two arguments (see ThingSpeakLog.h).
+        */
+        size_t dumpLog(Print & out)
+        {
+            return this->eventLog.dump(out);
+        }
+        
+        
+        /*
+        Function: drainLog
+        
+        Summary:
+        Take the oldest logged event that has not been dumped or drained yet.
+        
+        Parameters:
+        record - Receives the event
+        
+        Returns:
+        false if there are no more events.
+        
+        Notes:
+        Only available when TS_LOG_LEVEL is above TS_LOG_LEVEL_NONE.  When more than TS_LOG_LENGTH events are logged between drains, the oldest are lost.
+        */
+        bool drainLog(logRecord & record)
+        {
+            return this->eventLog.drain(record);
+        }
+#endif
+        
+        
+#ifdef TS_GZIP_RESPONSES
+        /*
+        Function: getLastResponseWireLength
+        
+        Summary:
+        Get the number of body bytes received for the last response, before it was decompressed.
+        
+        Returns:
+        Bytes received, compare with the length of the response to see how much gzip saved.
+        */
+        unsigned long getLastResponseWireLength()
+        {
+            return this->lastResponseWireLength;
+        }
+#endif
+        
+        
+#ifdef TS_WARM_START
+        /*
+        Function: saveState
+        
+        Summary:
+        Save a snapshot of the library state, for example before deep sleep.
+        
+        Parameters:
+        state - Snapshot to fill in, normally a retained variable
+        
+        Returns:
+        200 - OK / Success
+        -101 - A staged value, the status, or the last feed was too long to keep and was left out
+        
+        Notes:
+        The snapshot keeps the staged values not written yet, the values of the last feed read, the resolved address of the server, the time of the last accepted write, the entry IDs used by confirmDelivery(), and the bytes used from the data budget.  It is protected by a checksum, so restoreState() ignores a snapshot that retained memory did not keep.
+        */
+        int saveState(warmState & state)
+        {
+            drainQueuedFields();
+            int status = TS_OK_SUCCESS;
+            memset(&state, 0, sizeof(state));
+            state.magic = TS_WARM_MAGIC;
+            state.savedAt = this->clock.now();
+            for(unsigned int i = 0; i < 4; i++)
+            {
+                state.serverIP[i] = this->serverIP[i];
+            }
+            
+            for(unsigned int iField = 0; iField < FIELDNUM_MAX; iField++)
+            {
+                const stagedValue & value = this->nextWriteField[iField];
+                warmValue & kept = state.fields[iField];
+                kept.type = value.type;
+                #ifdef TS_DISABLE_FLOAT
+                kept.longValue = value.longValue;
+                #else
+                kept.samples = value.samples;          // Copies whichever member of the union is in use
+                #endif
+                if(value.type == TS_VALUE_TEXT && !copyWarmText(kept.text, TS_WARM_TEXT_LENGTH, value.text.c_str()))
+                {
+                    kept.type = TS_VALUE_NONE;
+                    status = TS_ERR_OUT_OF_RANGE;
+                }
+            }
+            #ifndef TS_DISABLE_LOCATION
+            state.latitude = this->nextWriteLatitude;
+            state.longitude = this->nextWriteLongitude;
+            state.elevation = this->nextWriteElevation;
+            #endif
+            #ifndef TS_DISABLE_STATUS
+            if(!copyWarmText(state.status, TS_WARM_STATUS_LENGTH, this->nextWriteStatus.c_str()))
+            {
+                state.status[0] = '\0';
+                status = TS_ERR_OUT_OF_RANGE;
+            }
+            #endif
+            if(!copyWarmText(state.createdAt, TS_WARM_TEXT_LENGTH, this->nextWriteCreatedAt.c_str()))
+            {
+                state.createdAt[0] = '\0';
+                status = TS_ERR_OUT_OF_RANGE;
+            }
+            
+            state.lastWriteTime = this->lastWriteTime;
+            state.lastEntryID = this->lastEntryID;
+            state.entryHighWaterMark = this->entryHighWaterMark;
+            state.budgetUsed = this->dataBudget.getUsed();
+            state.budgetPeriod = this->dataBudget.getPeriodKey();
+            
+            #ifndef TS_DISABLE_READS
+            // The values of the last feed are kept decoded, one after another
+            state.feedReadTime = this->feedReadTime;
+            unsigned int used = 0;
+            for(unsigned int valueIndex = 0; valueIndex < TS_FEED_VALUES; valueIndex++)
+            {
+                if(0 == (this->lastFeed.selected & (1u << valueIndex)))
+                {
+                    continue;
+                }
+                const char * value = getFeedValue(valueIndex);
+                size_t length = strlen(value);
+                if(used + length > TS_WARM_FEED_LENGTH)
+                {
+                    status = TS_ERR_OUT_OF_RANGE;
+                    continue;
+                }
+                memcpy(state.feedValues + used, value, length);
+                used += length;
+                state.feedLength[valueIndex] = length;
+                state.feedSelected |= (1u << valueIndex);
+            }
+            #endif
+            
+            state.checksum = warmStateChecksum(state);
+            return status;
+        }
+        
+        
+        /*
+        Function: restoreState
+        
+        Summary:
+        Restore the library state from a snapshot made by saveState(), for example after waking from deep sleep.
+        
+        Parameters:
+        state - Snapshot saved before sleeping
+        
+        Returns:
+        true if the snapshot was valid and has been restored, false if it was not and the state was left as it is.
+        
+        Notes:
+        Call after begin().  The snapshot can be restored once; it is marked as used so that a later restart does not restore stale values.  getFieldAsString() and the other get functions return the values of the restored feed without reading it again, and getFeedReadTime() tells how old they are.
+        */
+        bool restoreState(warmState & state)
+        {
+            if(state.magic != TS_WARM_MAGIC || state.checksum != warmStateChecksum(state))
+            {
+                return false;
+            }
+            state.magic = 0;
+            
+            this->serverIP = IPAddress(state.serverIP[0], state.serverIP[1], state.serverIP[2], state.serverIP[3]);
+            for(unsigned int iField = 0; iField < FIELDNUM_MAX; iField++)
+            {
+                const warmValue & kept = state.fields[iField];
+                stagedValue & value = this->nextWriteField[iField];
+                value.type = kept.type;
+                #ifdef TS_DISABLE_FLOAT
+                value.longValue = kept.longValue;
+                #else
+                value.samples = kept.samples;
+                #endif
+                value.text = (kept.type == TS_VALUE_TEXT) ? kept.text : "";
+            }
+            #ifndef TS_DISABLE_LOCATION
+            this->nextWriteLatitude = state.latitude;
+            this->nextWriteLongitude = state.longitude;
+            this->nextWriteElevation = state.elevation;
+            #endif
+            #ifndef TS_DISABLE_STATUS
+            this->nextWriteStatus = state.status;
+            #endif
+            this->nextWriteCreatedAt = state.createdAt;
+            
+            this->lastWriteTime = state.lastWriteTime;
+            this->lastEntryID = state.lastEntryID;
+            this->entryHighWaterMark = state.entryHighWaterMark;
+            unsigned long lastWriteAgeMs = 0xFFFFFFFFul;
+            unsigned long now = this->clock.now();
+            if(0 != state.lastWriteTime && 0 != now && now >= state.lastWriteTime && now - state.lastWriteTime < 0xFFFFFFFFul / 1000)
+            {
+                lastWriteAgeMs = (now - state.lastWriteTime) * 1000;
+            }
+            this->dataBudget.restore(state.budgetUsed, state.budgetPeriod, lastWriteAgeMs, lastWriteAgeMs != 0xFFFFFFFFul);
+            
+            #ifndef TS_DISABLE_READS
+            // Rebuild the last feed with each value already decoded and terminated in place
+            String content = String("");
+            unsigned int position = 0;
+            for(unsigned int valueIndex = 0; valueIndex < TS_FEED_VALUES; valueIndex++)
+            {
+                this->lastFeed.valueStart[valueIndex] = 0;
+                this->lastFeed.valueLength[valueIndex] = 0;
+                if(0 == (state.feedSelected & (1u << valueIndex)))
+                {
+                    continue;
+                }
+                unsigned int length = state.feedLength[valueIndex];
+                if(position + length > TS_WARM_FEED_LENGTH)
+                {
+                    break;
+                }
+                this->lastFeed.valueStart[valueIndex] = content.length();
+                this->lastFeed.valueLength[valueIndex] = length;
+                for(unsigned int i = 0; i < length; i++)
+                {
+                    content += state.feedValues[position + i];
+                }
+                content += ' ';
+                position += length;
+            }
+            this->lastFeed.content = content;
+            for(unsigned int valueIndex = 0; valueIndex < TS_FEED_VALUES; valueIndex++)
+            {
+                if(state.feedSelected & (1u << valueIndex))
+                {
+                    this->lastFeed.content.setCharAt(this->lastFeed.valueStart[valueIndex] + this->lastFeed.valueLength[valueIndex], '\0');
+                }
+            }
+            this->lastFeed.format = TS_FEED_FORMAT_VALUE;
+            this->lastFeed.selected = state.feedSelected;
+            this->lastFeed.decoded = state.feedSelected;
+            this->lastFeed.indexed = true;
+            this->feedReadTime = state.feedReadTime;
+            #endif
+            return true;
+        }
+        
+        
+        #ifndef TS_DISABLE_READS
+        /*
+        Function: getFeedReadTime
+        
+        Summary:
+        Get when the values returned by getFieldAsString() and the other get functions were read, so a sketch can skip reading them again.
+        
+        Returns:
+        UTC time in seconds, or 0 if it is not known.
+        */
+        unsigned long getFeedReadTime()
+        {
+            return this->feedReadTime;
+        }
+        #endif
+        
+        
+        /*
+        Function: getLastWriteTime
+        
+        Summary:
+        Get when ThingSpeak last accepted a write, including one made before a restoreState().
+        
+        Returns:
+        UTC time in seconds, or 0 if it is not known.
+        
+        Notes:
+        Use it to keep to the rate limit of the channel after waking, instead of waiting the full interval.
+        */
+        unsigned long getLastWriteTime()
+        {
+            return this->lastWriteTime;
+        }
+#endif
+        
+        
+#if PLATFORM_THREADING
+        /*
+        Function: beginWorker
+        
+        Summary:
+        Start a thread that makes the network calls of writeFieldsAsync(), writeRawAsync(), readStringFieldAsync(), and readRawAsync().
+        
+        Returns:
+        true if the worker thread is running.
+        
+        Notes:
+        Call after begin().  The blocking read and write functions can still be called while the worker is running.  They share the client with the worker thread, so each one waits for the request the worker is sending to finish, and the worker waits for them.  getLastReadStatus() only reports the blocking reads.
+        */
+        bool beginWorker()
+        {
+            if(NULL != this->workerThread)
+            {
+                return true;
+            }
+            if(0 != os_queue_create(&this->workerQueue, sizeof(uint8_t), TS_WORKER_QUEUE_LENGTH, NULL))
+            {
+                return false;
+            }
+            this->workerThread = new Thread("thingspeak", workerMain, this, OS_THREAD_PRIORITY_DEFAULT, TS_WORKER_STACK_SIZE);
+            if(NULL == this->workerThread || !this->workerThread->isValid())
+            {
+                // Out of memory for the thread or its stack
+                delete this->workerThread;
+                this->workerThread = NULL;
+                os_queue_destroy(this->workerQueue, NULL);
+                this->workerQueue = NULL;
+                return false;
+            }
+            return true;
+        }
+        
+        
+        /*
+        Function: writeFieldsAsync
+        
+        Summary:
+        Queue a write of the multi-field update to the worker thread.
+        
+        Parameters:
+        channelNumber - Channel number
+        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        callback - Optional function called on the worker thread when the write is done, or with -503 if it is dropped for newer requests
+        context - Passed to the callback
+        
+        Returns:
+        A ThingSpeakFuture that gives the same status as writeFields() when the write is done.
+        
+        Notes:
+        The staged values are copied and cleared before this returns, so the next update can be staged right away.  writeAPIKey must stay valid until the write is done.
+        */
+        ThingSpeakFuture writeFieldsAsync(unsigned long channelNumber, const char * writeAPIKey, ThingSpeakCallback callback = NULL, void * context = NULL)
+        {
+            drainQueuedFields();
+            if(!hasStagedValues())
+            {
+                return ThingSpeakFuture(TS_ERR_SETFIELD_NOT_CALLED);
+            }
+            String staged = String("");
+            ThingSpeakStringPrinter stagedPrinter(staged);
+            printStagedValues(stagedPrinter, isConservingData());
+            resetWriteFields();
+            return submitRequest(TS_OPERATION_WRITE, takeWritePriority(), channelNumber, staged, writeAPIKey, callback, context);
+        }
+        
+        
+        /*
+        Function: writeRawAsync
+        
+        Summary:
+        Queue a raw POST to the worker thread.
+        
+        Parameters:
+        channelNumber - Channel number
+        postMessage - Raw URL to write to ThingSpeak as a string.  See the documentation at https://thingspeak.com/docs/channels#update_feed.
+        writeAPIKey - Write API key associated with the channel.  *If you share code with others, do _not_ share this key*
+        callback - Optional function called on the worker thread when the write is done, or with -503 if it is dropped for newer requests
+        context - Passed to the callback
+        
+        Returns:
+        A ThingSpeakFuture that gives the same status as writeRaw() when the write is done.
+        
+        Notes:
+        writeAPIKey must stay valid until the write is done.
+        */
+        ThingSpeakFuture writeRawAsync(unsigned long channelNumber, String postMessage, const char * writeAPIKey, ThingSpeakCallback callback = NULL, void * context = NULL)
+        {
+            return submitRequest(TS_OPERATION_WRITE, takeWritePriority(), channelNumber, postMessage, writeAPIKey, callback, context);
+        }
+        
+        
+        #ifndef TS_DISABLE_READS
+        /*
+        Function: readStringFieldAsync
+        
+        Summary:
+        Queue a read of the latest string of a field to the worker thread.
+        
+        Parameters:
+        channelNumber - Channel number
+        field - Field number (1-8) within the channel to read from.
+        readAPIKey - Read API key associated with the channel, or NULL for a public channel.
+        callback - Optional function called on the worker thread when the read is done, or with -503 if it is dropped for newer requests
+        context - Passed to the callback
+        
+        Returns:
+        A ThingSpeakFuture whose getResponse() is the value read.
+        
+        Notes:
+        readAPIKey must stay valid until the read is done.
+        */
+        ThingSpeakFuture readStringFieldAsync(unsigned long channelNumber, unsigned int field, const char * readAPIKey, ThingSpeakCallback callback = NULL, void * context = NULL)
+        {
+            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX)
+            {
+                return ThingSpeakFuture(TS_ERR_INVALID_FIELD_NUM);
+            }
+            return submitRequest(TS_OPERATION_READ, TS_PRIORITY_NORMAL, channelNumber, String("/fields/") + String(field) + String("/last"), readAPIKey, callback, context);
+        }
+        
+        
+        /*
+        Function: readRawAsync
+        
+        Summary:
+        Queue a raw read to the worker thread.
+        
+        Parameters:
+        channelNumber - Channel number
+        URLSuffix - Raw URL to read from ThingSpeak as a String.  See the documentation at https://thingspeak.com/docs/channels#get_feed
+        readAPIKey - Read API key associated with the channel, or NULL for a public channel.
+        callback - Optional function called on the worker thread when the read is done, or with -503 if it is dropped for newer requests
+        context - Passed to the callback
+        
+        Returns:
+        A ThingSpeakFuture whose getResponse() is the response of readRaw().
+        
+        Notes:
+        readAPIKey must stay valid until the read is done.
+        */
+        ThingSpeakFuture readRawAsync(unsigned long channelNumber, String URLSuffix, const char * readAPIKey, ThingSpeakCallback callback = NULL, void * context = NULL)
+        {
+            return submitRequest(TS_OPERATION_READ, TS_PRIORITY_NORMAL, channelNumber, URLSuffix, readAPIKey, callback, context);
+        }
+        #endif
+#endif
+        
+        
+    private:
+        
+#if PLATFORM_THREADING
+        // Claims a request and hands it to the worker thread.  A bulk write replaces a queued bulk write to the same
+        // channel.  When no request is free, the oldest queued request of the lowest priority below this one is dropped,
+        // and a critical request waits up to TS_WORKER_CRITICAL_WAIT_MS for the worker rather than fail at once.
+        ThingSpeakFuture submitRequest(uint8_t operation, uint8_t priority, unsigned long channelNumber, const String & payload, const char * apiKey, ThingSpeakCallback callback, void * context)
+        {
+            if(NULL == this->workerThread)
+            {
+                return ThingSpeakFuture(TS_ERR_NOT_READY);
+            }
+            if(operation == TS_OPERATION_WRITE && priority == TS_PRIORITY_NORMAL && isConservingData())
+            {
+                priority = TS_PRIORITY_BULK;
+            }
+            int index;
+            bool replaced;                     // Taken from a queued request, which already has its entry in workerQueue
+            unsigned long waitStartedAt = millis();
+            while(true)
+            {
+                index = -1;
+                if(operation == TS_OPERATION_WRITE && priority == TS_PRIORITY_BULK)
+                {
+                    index = claimQueuedRequest(TS_PRIORITY_NORMAL, true, channelNumber);
+                }
+                if(index >= 0)
+                {
+                    replaced = true;
+                    break;
+                }
+                index = claimFreeRequest();
+                if(index >= 0)
+                {
+                    replaced = false;
+                    break;
+                }
+                index = claimQueuedRequest(priority, false, 0);
+                if(index >= 0)
+                {
+                    replaced = true;
+                    break;
+                }
+                if(priority != TS_PRIORITY_CRITICAL || millis() - waitStartedAt >= TS_WORKER_CRITICAL_WAIT_MS)
+                {
+                    return ThingSpeakFuture(TS_ERR_QUEUE_FULL);
+                }
+                delay(TS_WORKER_POLL_MS);
+            }
+            
+            workerRequest & request = this->workerRequests[index];
+            unsigned long sequence = this->workerSequence.fetch_add(1, std::memory_order_relaxed) + 1;
+            {
+                std::lock_guard<Mutex> lock(request.resultLock);
+                // Futures still holding the old sequence now see their result as expired
+                request.sequence.store(sequence, std::memory_order_release);
+                request.operation = operation;
+                request.priority = priority;
+                request.channelNumber = channelNumber;
+                request.apiKey = apiKey;
+                request.payload = payload;
+                request.status = TS_ERR_NOT_READY;
+                request.response = String("");
+                request.callback = callback;
+                request.context = context;
+            }
+            request.state.store(TS_REQUEST_QUEUED, std::memory_order_release);
+            uint8_t queueEntry = index;
+            if(!replaced && 0 != os_queue_put(this->workerQueue, &queueEntry, 0, NULL))
+            {
+                request.state.store(TS_REQUEST_FREE, std::memory_order_release);
+                return ThingSpeakFuture(TS_ERR_QUEUE_FULL);
+            }
+            return ThingSpeakFuture(&request, sequence);
+        }
+        
+        // Claims a free or finished request, starting after the last one claimed, or -1 if there is none
+        int claimFreeRequest()
+        {
+            unsigned int first = this->nextWorkerRequest.fetch_add(1, std::memory_order_relaxed);
+            for(unsigned int i = 0; i < TS_WORKER_QUEUE_LENGTH; i++)
+            {
+                uint8_t index = (first + i) % TS_WORKER_QUEUE_LENGTH;
+                uint8_t state = this->workerRequests[index].state.load(std::memory_order_acquire);
+                if((state == TS_REQUEST_FREE || state == TS_REQUEST_DONE) && this->workerRequests[index].state.compare_exchange_strong(state, TS_REQUEST_CLAIMED, std::memory_order_acq_rel))
+                {
+                    return index;
+                }
+            }
+            return -1;
+        }
+        
+        // Drops the oldest queued request of the lowest priority below priority, optionally only a write to
+        // channelNumber, and claims it.  Returns -1 if there is none.
+        int claimQueuedRequest(uint8_t priority, bool sameChannel, unsigned long channelNumber)
+        {
+            while(true)
+            {
+                int victim = -1;
+                unsigned long victimSequence = 0;
+                for(unsigned int index = 0; index < TS_WORKER_QUEUE_LENGTH; index++)
+                {
+                    workerRequest & request = this->workerRequests[index];
+                    if(request.state.load(std::memory_order_acquire) != TS_REQUEST_QUEUED || request.priority <= priority)
+                    {
+                        continue;
+                    }
+                    if(sameChannel && (request.operation != TS_OPERATION_WRITE || request.channelNumber != channelNumber))
+                    {
+                        continue;
+                    }
+                    unsigned long sequence = request.sequence.load(std::memory_order_acquire);
+                    if(victim < 0 || request.priority > this->workerRequests[victim].priority || (request.priority == this->workerRequests[victim].priority && sequence < victimSequence))
+                    {
+                        victim = index;
+                        victimSequence = sequence;
+                    }
+                }
+                if(victim < 0)
+                {
+                    return -1;
+                }
+                workerRequest & request = this->workerRequests[victim];
+                uint8_t state = TS_REQUEST_QUEUED;
+                if(request.state.compare_exchange_strong(state, TS_REQUEST_CLAIMED, std::memory_order_acq_rel))
+                {
+                    if(NULL != request.callback && !queueExpiredCallback(request.callback, request.context))
+                    {
+                        // No room to hand its -503 to the worker, so it is not dropped
+                        request.state.store(TS_REQUEST_QUEUED, std::memory_order_release);
+                        return -1;
+                    }
+                    return victim;
+                }
+                // The worker took it first, look again
+            }
+        }
+        
+        // Keeps the callback of a dropped request for the worker thread, false if TS_WORKER_QUEUE_LENGTH are already waiting
+        bool queueExpiredCallback(ThingSpeakCallback callback, void * context)
+        {
+            for(unsigned int index = 0; index < TS_WORKER_QUEUE_LENGTH; index++)
+            {
+                expiredCallback & expired = this->expiredCallbacks[index];
+                uint8_t state = TS_REQUEST_FREE;
+                if(expired.state.compare_exchange_strong(state, TS_REQUEST_CLAIMED, std::memory_order_acq_rel))
+                {
+                    expired.callback = callback;
+                    expired.context = context;
+                    expired.state.store(TS_REQUEST_QUEUED, std::memory_order_release);
+                    return true;
+                }
+            }
+            return false;
+        }
+        
+        // Called by the worker thread before it runs the next request, so a dropped request hears of it first
+        void callExpiredCallbacks()
+        {
+            for(unsigned int index = 0; index < TS_WORKER_QUEUE_LENGTH; index++)
+            {
+                expiredCallback & expired = this->expiredCallbacks[index];
+                if(expired.state.load(std::memory_order_acquire) == TS_REQUEST_QUEUED)
+                {
+                    ThingSpeakCallback callback = expired.callback;
+                    void * context = expired.context;
+                    expired.state.store(TS_REQUEST_FREE, std::memory_order_release);
+                    callback(TS_ERR_RESULT_EXPIRED, String(""), context);
+                }
+            }
+        }
+        
+        // Takes the queued request of the highest priority, oldest first, or NULL if another thread has it claimed
+        workerRequest * takeNextRequest()
+        {
+            int next = -1;
+            unsigned long nextSequence = 0;
+            for(unsigned int index = 0; index < TS_WORKER_QUEUE_LENGTH; index++)
+            {
+                workerRequest & request = this->workerRequests[index];
+                if(request.state.load(std::memory_order_acquire) != TS_REQUEST_QUEUED)
+                {
+                    continue;
+                }
+                unsigned long sequence = request.sequence.load(std::memory_order_acquire);
+                if(next < 0 || request.priority < this->workerRequests[next].priority || (request.priority == this->workerRequests[next].priority && sequence < nextSequence))
+                {
+                    next = index;
+                    nextSequence = sequence;
+                }
+            }
+            if(next < 0)
+            {
+                return NULL;
+            }
+            uint8_t state = TS_REQUEST_QUEUED;
+            if(!this->workerRequests[next].state.compare_exchange_strong(state, TS_REQUEST_RUNNING, std::memory_order_acq_rel))
+            {
+                return NULL;
+            }
+            return &this->workerRequests[next];
+        }
+        
+        static void workerMain(void * param)
+        {
+            ((ThingSpeakClass *)param)->runWorker();
+        }
+        
+        void runWorker()
+        {
+            while(true)
+            {
+                // Each entry in workerQueue stands for one queued request, which is not necessarily the one taken
+                uint8_t queueEntry;
+                if(0 != os_queue_take(this->workerQueue, &queueEntry, autoPrepareWaitMs(), NULL))
+                {
+                    autoPrepare();
+                    continue;
+                }
+                callExpiredCallbacks();
+                workerRequest * next;
+                while(NULL == (next = takeNextRequest()))
+                {
+                    // A request being replaced is briefly not queued
+                    delay(TS_WORKER_POLL_MS);
+                    callExpiredCallbacks();
+                }
+                workerRequest & request = *next;
+                {
+                    // Keeps the blocking calls of the application thread off the client until the request is done
+                    std::lock_guard<RecursiveMutex> lock(this->networkLock);
+                    if(request.operation == TS_OPERATION_WRITE)
+                    {
+                        request.status = writeUpdate(request.channelNumber, &request.payload, request.apiKey, request.priority);
+                    }
+                    #ifndef TS_DISABLE_READS
+                    else
+                    {
+                        int applicationReadStatus = this->lastReadStatus;
+                        request.response = readRaw(request.channelNumber, request.payload, request.apiKey);
+                        request.status = this->lastReadStatus;
+                        this->lastReadStatus = applicationReadStatus;
+                    }
+                    #endif
+                }
+                // Done before the callback, so a future of this request is ready inside it.  The request can be reused
+                // for a new call as soon as it is done, so the callback gets copies.
+                ThingSpeakCallback callback = request.callback;
+                void * context = request.context;
+                int status = request.status;
+                String response = (NULL != callback) ? request.response : String("");
+                request.state.store(TS_REQUEST_DONE, std::memory_order_release);
+                if(NULL != callback)
+                {
+                    callback(status, response, context);
+                }
+            }
+        }
+#endif
+        
+        // Sends the staged values from a copy that is kept if it is not known whether ThingSpeak stored them
+        int writeIdempotentUpdate(unsigned long channelNumber, const char * writeAPIKey)
+        {
+            if(this->nextWriteCreatedAt.length() == 0 && this->clock.isValid())
+            {
+                char timestamp[24];
+                formatUTCTimestamp(this->clock.now(), timestamp, sizeof(timestamp));
+                this->nextWriteCreatedAt = timestamp;
+            }
+            String update = String("");
+            ThingSpeakStringPrinter updatePrinter(update);
+            printStagedValues(updatePrinter, isConservingData());
+            tsTimestampValue createdAt;
+            createdAt = this->nextWriteCreatedAt.c_str();
+            resetWriteFields();
+            
+            int status = writeUpdate(channelNumber, &update, writeAPIKey, takeWritePriority());
+            if(status == TS_ERR_UNEXPECTED_FAIL || status == TS_ERR_BAD_RESPONSE || status == TS_ERR_TIMEOUT)
+            {
+                this->pendingUpdate = update;
+                this->pendingCreatedAt = createdAt.c_str();
+            }
+            return status;
+        }
+        
+        void clearPendingUpdate()
+        {
+            this->pendingUpdate = "";
+            this->pendingCreatedAt = "";
+        }
+        
+        #ifndef TS_DISABLE_READS
+        // True if every field of the pending update has the value it was sent with in the entry, false if it has no field to compare
+        bool pendingFieldsMatch(const String & content)
+        {
+            bool compared = false;
+            int position = 0;
+            int length = this->pendingUpdate.length();
+            while(position < length)
+            {
+                // Values are sent escaped, so '&' only separates them
+                int end = this->pendingUpdate.indexOf('&', position);
+                if(end < 0)
+                {
+                    end = length;
+                }
+                String pair = this->pendingUpdate.substring(position, end);
+                position = end + 1;
+                int equals = pair.indexOf('=');
+                if(equals < 0 || !pair.startsWith("field"))
+                {
+                    continue;
+                }
+                if(escapeUrl(getJSONValueByKey(content, pair.substring(0, equals))) != pair.substring(equals + 1))
+                {
+                    return false;
+                }
+                compared = true;
+            }
+            return compared;
+        }
+        #endif
+        
+        void acknowledgeEntry(long entryID)
+        {
+            this->lastEntryID = entryID;
+            #ifdef TS_WARM_START
+                this->lastWriteTime = this->clock.now();
+            #endif
+            if(entryID > this->entryHighWaterMark)
+            {
+                this->entryHighWaterMark = entryID;
+            }
+        }
+        
+        // Formats a time in the form ThingSpeak returns created-at timestamps
+        void formatUTCTimestamp(time_t time, char * timestamp, size_t size)
+        {
+            struct tm utc;
+            gmtime_r(&time, &utc);
+            snprintf(timestamp, size, "%04d-%02d-%02dT%02d:%02d:%02dZ", utc.tm_year + 1900, utc.tm_mon + 1, utc.tm_mday, utc.tm_hour, utc.tm_min, utc.tm_sec);
+        }
+        
+        // Finds an unquoted number, like "entry_id":42
+        long getJSONNumberByKey(const String & textToSearch, const String & key)
+        {
+            String searchPhrase = String("\"") + key + String("\":");
+            int fromPosition = textToSearch.indexOf(searchPhrase);
+            if(fromPosition == -1)
+            {
+                return 0;
+            }
+            return atol(textToSearch.c_str() + fromPosition + searchPhrase.length());
+        }
+        
+        // Creates a new String
+        String escapeUrl(String message){
+            char t;
+            char ch[] = " ";
+            char temp[4];
+            char *encoded;
+            String result = "";
+            unsigned int i;
+            unsigned int n = message.length() + 1;  // add an extra for the null
+            
+            // figure out the length of the char array
+            for(i = 0; i < message.length(); i++){
+                t = message.charAt(i);
+                if( (t >= 0x00 && t <= 0x1F) || t >= 0x80 ){
+                    n--;
+                    continue;
+                }
+                if(t == 0x22 || t == 0x25 || t == 0x26 || t == 0x2B || t == 0x3B){
+                    n = n + 2;
+                }
+            }
+            
+            // create the char array
+            encoded = (char *)malloc(sizeof(char) * n);
+            if(encoded == NULL){
+                return result;
+            }
+            encoded[0] = 0;
+                
+            // build the char array
+            for(i = 0; i < message.length(); i++){
+                t = message.charAt(i);
+                // don't include non-printable or anything about 127
+                if( (t >= 0x00 && t <= 0x1F) || t >= 0x80 ){
+                    continue;
+                }
+                // encode the special characters
+                if(t == 0x22 || t == 0x25 || t == 0x26 || t == 0x2B || t == 0x3B){
+                    sprintf(temp, "%%%02X", t);
+                    strcat(encoded, temp);
+                    continue;
+                }
+                // add the regular characters
+                ch[0] = t;
+                strcat(encoded, ch);
+            }
+                
+            result = String(encoded);
+            free(encoded);
+            
+            return result;
+        }
+        
+        String getJSONValueByKey(String textToSearch, String key)
+        {
+            if(textToSearch.length() == 0){
+                return String("");
+            }
+            
+            String searchPhrase = String("\"") + key + String("\":\"");
+            
+            int fromPosition = textToSearch.indexOf(searchPhrase,0);
+            
+            if(fromPosition == -1){
+                // return because there is no status or it's null
+                return String("");
+            }
+            
+            fromPosition = fromPosition + searchPhrase.length();
+                    
+            int toPosition = textToSearch.indexOf("\"", fromPosition);
+            
+            
+            if(toPosition == -1){
+                // return because there is no end quote
+                return String("");
+            }
+            
+            textToSearch.remove(toPosition);
+            
+            return textToSearch.substring(fromPosition);
+        }
+        
+        // Reads one comma separated value starting at position, handling double-quoted values
+        String nextCSVValue(String & csvContent, unsigned int & position)
+        {
+            String value = String("");
+            bool quoted = (position < csvContent.length() && csvContent.charAt(position) == '"');
+            if(quoted)
+            {
+                position++;
+            }
+            while(position < csvContent.length())
+            {
+                char ch = csvContent.charAt(position);
+                if(quoted && ch == '"')
+                {
+                    if(position + 1 < csvContent.length() && csvContent.charAt(position + 1) == '"')
+                    {
+                        // An escaped quote inside a quoted value
+                        value.concat('"');
+                        position += 2;
+                        continue;
+                    }
+                    quoted = false;
+                    position++;
+                    continue;
+                }
+                if(!quoted && (ch == ',' || ch == '\r' || ch == '\n'))
+                {
+                    break;
+                }
+                value.concat(ch);
+                position++;
+            }
+            return value;
+        }
+        
+        // Maps each column of a CSV feed header to a field index (0-7), TS_CSV_CREATED_AT, or -1 for other columns
+        bool readCSVHeader(String & csvContent, unsigned int & position, int8_t * columnFields, unsigned int & columns)
+        {
+            columns = 0;
+            while(position < csvContent.length())
+            {
+                String name = nextCSVValue(csvContent, position);
+                if(columns < TS_CSV_COLUMNS_MAX)
+                {
+                    int8_t field = -1;
+                    if(name == "created_at")
+                    {
+                        field = TS_CSV_CREATED_AT;
+                    }
+                    else if(name.startsWith("field") && name.length() == 6 && name.charAt(5) >= '1' && name.charAt(5) <= '8')
+                    {
+                        field = name.charAt(5) - '1';
+                    }
+                    columnFields[columns++] = field;
+                }
+                if(position < csvContent.length() && csvContent.charAt(position) == ',')
+                {
+                    position++;
+                    continue;
+                }
+                break;
+            }
+            while(position < csvContent.length() && (csvContent.charAt(position) == '\r' || csvContent.charAt(position) == '\n'))
+            {
+                position++;
+            }
+            return columns > 0;
+        }
+        
+        // Reads the next record of a CSV feed, fieldValues receives fields 1-8 and may be NULL
+        bool nextCSVRecord(String & csvContent, unsigned int & position, const int8_t * columnFields, unsigned int columns, String & createdAt, String * fieldValues)
+        {
+            createdAt = "";
+            if(position >= csvContent.length())
+            {
+                return false;
+            }
+            for(unsigned int column = 0; ; column++)
+            {
+                String value = nextCSVValue(csvContent, position);
+                if(column < columns && columnFields[column] == TS_CSV_CREATED_AT)
+                {
+                    createdAt = value;
+                }
+                else if(column < columns && columnFields[column] >= 0 && NULL != fieldValues)
+                {
+                    fieldValues[columnFields[column]] = value;
+                }
+                if(position < csvContent.length() && csvContent.charAt(position) == ',')
+                {
+                    position++;
+                    continue;
+                }
+                break;
+            }
+            while(position < csvContent.length() && (csvContent.charAt(position) == '\r' || csvContent.charAt(position) == '\n'))
+            {
+                position++;
+            }
+            return createdAt.length() > 0;
+        }
+        
+        // Parses one field column of a CSV feed into values, keeping the most recent maxValues rows
+        unsigned int parseCSVSeries(String & csvContent, unsigned int field, float * values, unsigned int maxValues)
+        {
+            int recordStart = csvContent.indexOf('\n');
+            if(recordStart == -1){
+                // return because there are no records after the header
+                return 0;
+            }
+            
+            // Find the column holding the field
+            String fieldKey = String("field") + String(field);
+            unsigned int headerPosition = 0;
+            int fieldColumn = -1;
+            for(int column = 0; headerPosition < (unsigned int)recordStart; column++)
+            {
+                if(nextCSVValue(csvContent, headerPosition) == fieldKey)
+                {
+                    fieldColumn = column;
+                    break;
+                }
+                if(csvContent.charAt(headerPosition) != ',') break;
+                headerPosition++;
+            }
+            if(fieldColumn == -1){
+                // return because the field is not in the response
+                return 0;
+            }
+            
+            unsigned int count = 0;
+            unsigned int position = recordStart + 1;
+            while(position < csvContent.length())
+            {
+                String value = String("");
+                for(int column = 0; column <= fieldColumn && position < csvContent.length(); column++)
+                {
+                    value = nextCSVValue(csvContent, position);
+                    if(column < fieldColumn)
+                    {
+                        if(csvContent.charAt(position) != ',') break;
+                        position++;
+                    }
+                }
+                
+                // Skip the rest of the record
+                int nextRecord = csvContent.indexOf('\n', position);
+                position = (nextRecord == -1) ? csvContent.length() : nextRecord + 1;
+                
+                value.trim();
+                if(value.length() == 0) continue;
+                if(count == maxValues)
+                {
+                    // Drop the oldest value to keep the most recent ones
+                    memmove(values, values + 1, (maxValues - 1) * sizeof(float));
+                    count--;
+                }
+                values[count++] = convertStringToFloat(value);
+            }
+            return count;
+        }
+        
+        #ifndef TS_DISABLE_READS
+        // Keeps a response as the latest feed record, it is indexed when the first value is fetched
+        void storeLastFeed(String & content, uint8_t format, uint16_t selected)
+        {
+            this->lastFeed.content = content;
+            this->lastFeed.format = format;
+            this->lastFeed.selected = selected;
+            this->lastFeed.decoded = 0;
+            this->lastFeed.indexed = false;
+            #ifdef TS_WARM_START
+                this->feedReadTime = this->clock.now();
+            #endif
+        }
+        
+        // Fetches one value of the latest feed record, decoding it in place the first time it is fetched
+        const char * getFeedValue(unsigned int valueIndex)
+        {
+            if(0 == (this->lastFeed.selected & (1u << valueIndex))) return "";
+            if(!this->lastFeed.indexed) indexLastFeed();
+            if(0 == this->lastFeed.valueLength[valueIndex]) return "";
+            if(0 == (this->lastFeed.decoded & (1u << valueIndex))) decodeFeedValue(valueIndex);
+            return this->lastFeed.content.c_str() + this->lastFeed.valueStart[valueIndex];
+        }
+        
+        int feedValueIndex(const char * key, unsigned int keyLength)
+        {
+            static const char * const valueNames[TS_FEED_VALUES] = {"field1", "field2", "field3", "field4", "field5", "field6", "field7", "field8",
+                                                                    "status", "latitude", "longitude", "elevation", "created_at"};
+            for(int valueIndex = 0; valueIndex < TS_FEED_VALUES; valueIndex++)
+            {
+                if(strlen(valueNames[valueIndex]) == keyLength && 0 == strncmp(valueNames[valueIndex], key, keyLength))
+                {
+                    return valueIndex;
+                }
+            }
+            return -1;
+        }
+        
+        void setFeedValue(int valueIndex, unsigned int valueStart, unsigned int valueLength)
+        {
+            if(valueIndex < 0) return;
+            this->lastFeed.valueStart[valueIndex] = valueStart;
+            this->lastFeed.valueLength[valueIndex] = valueLength;
+        }
+        
+        // Records where each value of the latest feed record starts and ends in a single scan of the content
+        void indexLastFeed()
+        {
+            const char * text = this->lastFeed.content.c_str();
+            unsigned int textLength = this->lastFeed.content.length();
+            memset(this->lastFeed.valueLength, 0, sizeof(this->lastFeed.valueLength));
+            this->lastFeed.indexed = true;
+            
+            if(this->lastFeed.format == TS_FEED_FORMAT_VALUE)
+            {
+                for(int valueIndex = 0; valueIndex < FIELDNUM_MAX; valueIndex++)
+                {
+                    if(this->lastFeed.selected & (1u << valueIndex)) setFeedValue(valueIndex, 0, textLength);
+                }
+            }
+            else if(this->lastFeed.format == TS_FEED_FORMAT_JSON)
+            {
+                unsigned int position = 0;
+                while(position < textLength)
+                {
+                    if(text[position++] != '"') continue;
+                    
+                    // Read the key, keys never contain escaped characters
+                    unsigned int keyStart = position;
+                    while(position < textLength && text[position] != '"') position++;
+                    int valueIndex = feedValueIndex(text + keyStart, position - keyStart);
+                    position++;
+                    if(position >= textLength || text[position] != ':') continue;
+                    position++;
+                    
+                    unsigned int valueStart = position;
+                    if(position < textLength && text[position] == '"')
+                    {
+                        valueStart = ++position;
+                        while(position < textLength && text[position] != '"')
+                        {
+                            // Step over escaped characters
+                            if(text[position] == '\\') position++;
+                            position++;
+                        }
+                        if(position > textLength) position = textLength;
+                        setFeedValue(valueIndex, valueStart, position - valueStart);
+                        position++;
+                    }
+                    else
+                    {
+                        while(position < textLength && text[position] != ',' && text[position] != '}') position++;
+                        if(0 != strncmp(text + valueStart, "null", 4)) setFeedValue(valueIndex, valueStart, position - valueStart);
+                    }
+                }
+            }
+            else
+            {
+                const char * recordText = strchr(text, '\n');
+                if(NULL == recordText) return;
+                unsigned int headerPosition = 0;
+                unsigned int recordPosition = (recordText - text) + 1;
+                while(headerPosition < textLength)
+                {
+                    unsigned int keyStart = headerPosition;
+                    while(headerPosition < textLength && text[headerPosition] != ',' && text[headerPosition] != '\r' && text[headerPosition] != '\n') headerPosition++;
+                    int valueIndex = feedValueIndex(text + keyStart, headerPosition - keyStart);
+                    
+                    unsigned int valueStart = recordPosition;
+                    if(recordPosition < textLength && text[recordPosition] == '"')
+                    {
+                        valueStart = ++recordPosition;
+                        while(recordPosition < textLength)
+                        {
+                            // A doubled quote is an escaped quote inside the value
+                            if(text[recordPosition] == '"' && text[recordPosition + 1] != '"') break;
+                            recordPosition += (text[recordPosition] == '"') ? 2 : 1;
+                        }
+                        setFeedValue(valueIndex, valueStart, recordPosition - valueStart);
+                        if(recordPosition < textLength) recordPosition++;
+                    }
+                    else
+                    {
+                        while(recordPosition < textLength && text[recordPosition] != ',' && text[recordPosition] != '\r' && text[recordPosition] != '\n') recordPosition++;
+                        setFeedValue(valueIndex, valueStart, recordPosition - valueStart);
+                    }
+                    
+                    if(text[headerPosition] != ',') break;
+                    headerPosition++;
+                    if(recordPosition < textLength && text[recordPosition] == ',') recordPosition++;
+                }
+            }
+        }
+        
+        // Removes the escaping from one value of the latest feed record and terminates it, in place
+        void decodeFeedValue(unsigned int valueIndex)
+        {
+            const char * text = this->lastFeed.content.c_str();
+            unsigned int from = this->lastFeed.valueStart[valueIndex];
+            unsigned int end = from + this->lastFeed.valueLength[valueIndex];
+            unsigned int to = from;
+            
+            while(from < end)
+            {
+                char ch = text[from++];
+                if(this->lastFeed.format == TS_FEED_FORMAT_JSON && ch == '\\' && from < end)
+                {
+                    ch = text[from++];
+                    if(ch == 'n') ch = '\n';
+                    else if(ch == 'r') ch = '\r';
+                    else if(ch == 't') ch = '\t';
+                }
+                else if(this->lastFeed.format == TS_FEED_FORMAT_CSV && ch == '"' && from < end && text[from] == '"')
+                {
+                    from++;
+                }
+                this->lastFeed.content.setCharAt(to++, ch);
+            }
+            // The character after the value is a quote or separator that has already been indexed past
+            this->lastFeed.content.setCharAt(to, '\0');
+            this->lastFeed.valueLength[valueIndex] = to - this->lastFeed.valueStart[valueIndex];
+            this->lastFeed.decoded |= (1u << valueIndex);
+        }
+        #endif
+        
+        // Posts postMessage, or the staged values when postMessage is NULL
+        int writeUpdate(unsigned long channelNumber, const String * postMessage, const char * writeAPIKey, uint8_t priority)
+        {
+            #if PLATFORM_THREADING
+                std::lock_guard<RecursiveMutex> lock(this->networkLock);
+            #endif
+            beginOperation();
+            reapWrite();
+            this->lastEntryID = 0;
+            this->lastWriteStartedAt = millis();
+            this->autoPrepareDone = false;
+            if(!checkDataBudget(true, priority))
+            {
+                return TS_ERR_BUDGET_EXCEEDED;
+            }
+            int connectStatus = deadlinePassed() ? TS_ERR_DEADLINE_EXCEEDED : connectThingSpeak();
+            if(connectStatus != TS_OK_SUCCESS)
+            {
+                // Failed to connect to ThingSpeak, or did not try because it has been unreachable or out of time
+                return connectStatus;
+            }
+            if(deadlinePassed())
+            {
+                this->client->stop();
+                return TS_ERR_DEADLINE_EXCEEDED;
+            }
+            this->dataBudget.recordWrite();
+
+            // Measure the body first, so it can be formatted straight into the client after the Content-Length
+            bool omitBulkFields = isConservingData();
+            ThingSpeakLengthCounter bodyLength;
+            printUpdateBody(bodyLength, postMessage, omitBulkFields);
+
+            TS_LOG_TRACE(TS_EVENT_POST, channelNumber, bodyLength.length());
+
+
+            // Post data to thingspeak
+            if(!this->client->print("POST /update HTTP/1.1\r\n")) return abortWriteRaw();
+            if(!writeHTTPHeader(writeAPIKey)) return abortWriteRaw();
+            if(!this->client->print("Content-Type: application/x-www-form-urlencoded\r\n")) return abortWriteRaw();
+            if(!this->client->print("Content-Length: ")) return abortWriteRaw();
+            if(!this->client->print(bodyLength.length())) return abortWriteRaw();
+            if(!this->client->print("\r\n\r\n")) return abortWriteRaw();
+            if(printUpdateBody(*this->client, postMessage, omitBulkFields) != bodyLength.length()) return abortWriteRaw();
+            
+            if(this->fireAndForget)
+            {
+                // The server accepted the connection, the response is read by the next call
+                this->client->flush();
+                recordBreakerResult(TS_OK_SENT);
+                this->writeInFlight = true;
+                this->writeSentAt = millis();
+                return TS_OK_SENT;
+            }
+      
+            String entryIDText = String();
+            int status = getHTTPResponse(entryIDText);
+            recordBreakerResult(status);
+            if(status != TS_OK_SUCCESS)
+            {
+                client->stop();
+                return status;
+            }
+            long entryID = entryIDText.toInt();
+
+            TS_LOG_INFO(TS_EVENT_ENTRY_ID, channelNumber, entryID);
+
+            client->stop();
+            
+            TS_LOG_TRACE(TS_EVENT_DISCONNECTED, 0, 0);
+            if(entryID == 0)
+            {
+                // ThingSpeak did not accept the write
+                status = TS_ERR_NOT_INSERTED;
+            }
+            else
+            {
+                acknowledgeEntry(entryID);
+            }
+            return status;
+        }
+        
+        // Reads the response of a write sent by fire and forget, if it has arrived, before the client is used again
+        void reapWrite()
+        {
+            if(!this->writeInFlight)
+            {
+                return;
+            }
+            this->writeInFlight = false;
+            int status = TS_ERR_TIMEOUT;
+            long entryID = 0;
+            if(this->client->available() > 0)
+            {
+                String entryIDText = String();
+                status = getHTTPResponse(entryIDText);
+                entryID = entryIDText.toInt();
+                recordBreakerResult(status);
+            }
+            else if(millis() - this->writeSentAt > TIMEOUT_MS_SERVERRESPONSE)
+            {
+                // A blocking write would have timed out by now, so a server that stops answering still opens the circuit
+                recordBreakerResult(TS_ERR_TIMEOUT);
+            }
+            this->client->stop();
+            TS_LOG_INFO(TS_EVENT_WRITE_REAPED, status, entryID);
+            if(status == TS_ERR_TIMEOUT)
+            {
+                this->unconfirmedWrites++;
+            }
+            else if(status == TS_OK_SUCCESS && entryID != 0)
+            {
+                this->confirmedWrites++;
+                acknowledgeEntry(entryID);
+            }
+            else
+            {
+                this->failedWrites++;
+            }
+        }
+        
+        size_t printUpdateBody(Print & out, const String * postMessage, bool omitBulkFields)
+        {
+            size_t written = 0;
+            if(NULL != postMessage)
+            {
+                written += out.print(*postMessage);
+            }
+            else
+            {
+                written += printStagedValues(out, omitBulkFields);
+            }
+            written += out.print("&headers=false");
+            return written;
+        }
+        
+        // Formats the staged values as a URL encoded form, leaving out bulk fields if omitBulkFields
+        size_t printStagedValues(Print & out, bool omitBulkFields)
+        {
+            size_t written = 0;
+            const char * separator = "";
+            for(size_t iField = 0; iField < 8; iField++)
+            {
+                if(this->nextWriteField[iField].type != TS_VALUE_NONE && !(omitBulkFields && this->fieldPriority[iField] == TS_PRIORITY_BULK))
+                {
+                    written += out.print(separator);
+                    written += out.print("field");
+                    written += out.print((char)('1' + iField));
+                    written += out.print('=');
+                    written += printStagedValue(out, iField);
+                    separator = "&";
+                }
+            }
+            
+            #ifndef TS_DISABLE_LOCATION
+            if(!isnan(this->nextWriteLatitude))
+            {
+                written += out.print(separator);
+                written += out.print("lat=");
+                written += out.print(String(this->nextWriteLatitude));
+                separator = "&";
+            }
+            
+            if(!isnan(this->nextWriteLongitude))
+            {
+                written += out.print(separator);
+                written += out.print("long=");
+                written += out.print(String(this->nextWriteLongitude));
+                separator = "&";
+            }
+            
+            if(!isnan(this->nextWriteElevation))
+            {
+                written += out.print(separator);
+                written += out.print("elevation=");
+                written += out.print(String(this->nextWriteElevation));
+                separator = "&";
+            }
+            #endif
+            
+            #ifndef TS_DISABLE_STATUS
+            if(this->nextWriteStatus.length() > 0 || hasSampleStatus())
+            {
+                written += out.print(separator);
+                written += out.print("status=");
+                written += printEscaped(out, this->nextWriteStatus.c_str());
+                #ifndef TS_DISABLE_FLOAT
+                written += printSampleStatus(out, this->nextWriteStatus.length() > 0);
+                #endif
+                separator = "&";
+            }
+            #endif
+            
+            if(this->nextWriteCreatedAt.length() > 0)
+            {
+                written += out.print(separator);
+                written += out.print("created_at=");
+                written += out.print(this->nextWriteCreatedAt.c_str());
+            }
+            return written;
+        }
+        
+        size_t printStagedValue(Print & out, size_t iField)
+        {
+            const stagedValue & value = this->nextWriteField[iField];
+            char valueString[20]; // range is -999999000000.00000 to 999999000000.00000, so 19 + 1 for the terminator
+            switch(value.type)
+            {
+                #ifndef TS_DISABLE_FLOAT
+                case TS_VALUE_SAMPLES:
+                    convertFloatToChar(reduceSamples(value, this->sampleReduction[iField]), valueString);
+                    return out.print(valueString);
+                case TS_VALUE_FLOAT:
+                    convertFloatToChar(value.floatValue, valueString);
+                    return out.print(valueString);
+                #endif
+                case TS_VALUE_LONG:
+                    ltoa(value.longValue, valueString, 10);
+                    return out.print(valueString);
+                case TS_VALUE_TEXT:
+                    return printEscaped(out, value.text.c_str());
+                default:
+                    return 0;
             }
-            
-            // create the char array
-            encoded = (char *)malloc(sizeof(char) * n);
-            if(encoded == NULL){
-                return result;
+        }
+        
+        #ifndef TS_DISABLE_FLOAT
+        float reduceSamples(const stagedValue & value, uint8_t reduction)
+        {
+            switch(reduction)
+            {
+                case TS_REDUCE_MIN:
+                    return value.samples.minimum;
+                case TS_REDUCE_MAX:
+                    return value.samples.maximum;
+                case TS_REDUCE_SUM:
+                    return value.samples.sum;
+                case TS_REDUCE_LAST:
+                    return value.samples.last;
+                default:
+                    return value.samples.sum / value.samples.count;
             }
-            encoded[0] = 0;
+        }
+        #endif
+        
+        bool hasSampleStatus()
+        {
+            #ifndef TS_DISABLE_FLOAT
+            for(size_t iField = 0; iField < 8; iField++)
+            {
+                if(this->nextWriteField[iField].type == TS_VALUE_SAMPLES && this->sampleReduction[iField] == TS_REDUCE_MINMAX_STATUS) return true;
+            }
+            #endif
+            return false;
+        }
+        
+        #ifndef TS_DISABLE_FLOAT
+        // Appends "fieldN min <minimum> max <maximum>" to the status for each field reduced with TS_REDUCE_MINMAX_STATUS
+        size_t printSampleStatus(Print & out, bool fSeparate)
+        {
+            size_t written = 0;
+            char valueString[20];
+            for(size_t iField = 0; iField < 8; iField++)
+            {
+                const stagedValue & value = this->nextWriteField[iField];
+                if(value.type != TS_VALUE_SAMPLES || this->sampleReduction[iField] != TS_REDUCE_MINMAX_STATUS) continue;
                 
-            // build the char array
-            for(i = 0; i < message.length(); i++){
-                t = message.charAt(i);
+                if(fSeparate) written += out.print(", ");
+                written += out.print("field");
+                written += out.print((char)('1' + iField));
+                written += out.print(" min ");
+                convertFloatToChar(value.samples.minimum, valueString);
+                written += out.print(valueString);
+                written += out.print(" max ");
+                convertFloatToChar(value.samples.maximum, valueString);
+                written += out.print(valueString);
+                fSeparate = true;
+            }
+            return written;
+        }
+        #endif
+        
+        // Same encoding as escapeUrl(), printed without building a String
+        size_t printEscaped(Print & out, const char * message)
+        {
+            size_t written = 0;
+            char temp[4];
+            for(const unsigned char * t = (const unsigned char *)message; *t != '\0'; t++)
+            {
                 // don't include non-printable or anything about 127
-                if( (t >= 0x00 && t <= 0x1F) || t >= 0x80 ){
+                if(*t <= 0x1F || *t >= 0x80){
                     continue;
                 }
                 // encode the special characters
-                if(t == 0x22 || t == 0x25 || t == 0x26 || t == 0x2B || t == 0x3B){
-                    sprintf(temp, "%%%02X", t);
-                    strcat(encoded, temp);
+                if(*t == 0x22 || *t == 0x25 || *t == 0x26 || *t == 0x2B || *t == 0x3B){
+                    sprintf(temp, "%%%02X", *t);
+                    written += out.print(temp);
                     continue;
                 }
-                // add the regular characters
-                ch[0] = t;
-                strcat(encoded, ch);
+                written += out.print((char)*t);
             }
-                
-            result = String(encoded);
-            free(encoded);
-            
-            return result;
+            return written;
         }
         
-        String getJSONValueByKey(String textToSearch, String key)
+        bool hasStagedValues()
         {
-            if(textToSearch.length() == 0){
-                return String("");
+            for(size_t iField = 0; iField < 8; iField++)
+            {
+                if(this->nextWriteField[iField].type != TS_VALUE_NONE) return true;
             }
-            
-            String searchPhrase = String("\"") + key + String("\":\"");
-            
-            int fromPosition = textToSearch.indexOf(searchPhrase,0);
-            
-            if(fromPosition == -1){
-                // return because there is no status or it's null
-                return String("");
+            #ifndef TS_DISABLE_LOCATION
+            if(!isnan(this->nextWriteLatitude) || !isnan(this->nextWriteLongitude) || !isnan(this->nextWriteElevation)) return true;
+            #endif
+            #ifndef TS_DISABLE_STATUS
+            if(this->nextWriteStatus.length() > 0) return true;
+            #endif
+            return this->nextWriteCreatedAt.length() > 0;
+        }
+        
+        int queueValue(unsigned int field, queuedValue & queued)
+        {
+            if(field < FIELDNUM_MIN || field > FIELDNUM_MAX) return TS_ERR_INVALID_FIELD_NUM;
+            queued.field = field;
+            return this->stagingQueue.push(queued) ? TS_OK_SUCCESS : TS_ERR_QUEUE_FULL;
+        }
+        
+        int abortWriteRaw()
+        {
+            this->client->stop();
+            TS_LOG_ERROR(TS_EVENT_ABORT, 1, 0);
+            recordBreakerResult(TS_ERR_UNEXPECTED_FAIL);
+            return TS_ERR_UNEXPECTED_FAIL;
+        }
+
+        // Runs the requests of readBatch() or writeBatch() over the clients, reading the responses as they arrive
+        template <class REQUEST>
+        unsigned int runBatch(REQUEST * requests, unsigned int requestCount, Client ** clients, unsigned int clientCount)
+        {
+            #if PLATFORM_THREADING
+                // The batch shares the data budget and the logged state with the worker
+                std::lock_guard<RecursiveMutex> lock(this->networkLock);
+            #endif
+            batchSlot slots[TS_READ_POOL_MAX];
+            if(clientCount > TS_READ_POOL_MAX)
+            {
+                clientCount = TS_READ_POOL_MAX;
+            }
+            for(unsigned int iSlot = 0; iSlot < clientCount; iSlot++)
+            {
+                slots[iSlot].request = -1;
+                slots[iSlot].client.attach(clients[iSlot], &this->dataBudget);
             }
             
-            fromPosition = fromPosition + searchPhrase.length();
+            beginOperation();
+            unsigned int next = 0;
+            unsigned int succeeded = 0;
+            unsigned int busy = 0;
+            while(next < requestCount || busy > 0)
+            {
+                bool progress = false;
+                for(unsigned int iSlot = 0; iSlot < clientCount; iSlot++)
+                {
+                    batchSlot & slot = slots[iSlot];
+                    Client & client = slot.client;
+                    if(slot.request < 0)
+                    {
+                        if(next < requestCount)
+                        {
+                            slot.client.resetCount();
+                            if(deadlinePassed())
+                            {
+                                // Requests not started in time are not sent
+                                requests[next].status = TS_ERR_DEADLINE_EXCEEDED;
+                                requests[next].elapsedMs = 0;
+                                requests[next].bytes = 0;
+                            }
+                            else if(startBatchRequest(client, slot, requests[next], next))
+                            {
+                                busy++;
+                            }
+                            else
+                            {
+                                requests[next].bytes = slot.client.getRequestBytes();
+                            }
+                            next++;
+                            progress = true;
+                        }
+                        continue;
+                    }
                     
-            int toPosition = textToSearch.indexOf("\"", fromPosition);
-            
-            
-            if(toPosition == -1){
-                // return because there is no end quote
-                return String("");
+                    REQUEST & request = requests[slot.request];
+                    bool done = false;
+                    uint8_t buffer[64];
+                    int available;
+                    while(!done && (available = client.available()) > 0)
+                    {
+                        int length = client.read(buffer, (available < (int)sizeof(buffer)) ? available : sizeof(buffer));
+                        for(int i = 0; i < length && !done; i++)
+                        {
+                            done = slot.parser.feed(buffer[i]);
+                        }
+                        progress = true;
+                    }
+                    if(done)
+                    {
+                        request.status = slot.parser.getStatus();
+                    }
+                    else if(!client.connected())
+                    {
+                        request.status = slot.parser.finish();
+                    }
+                    else if(millis() - slot.sentAt >= TIMEOUT_MS_SERVERRESPONSE || deadlinePassed())
+                    {
+                        TS_LOG_WARN(TS_EVENT_TIMEOUT, millis() - slot.sentAt, 0);
+                        request.status = deadlinePassed() ? TS_ERR_DEADLINE_EXCEEDED : TS_ERR_TIMEOUT;
+                    }
+                    else
+                    {
+                        continue;
+                    }
+                    
+                    client.stop();
+                    TS_LOG_TRACE(TS_EVENT_RESPONSE, request.status, request.response.length());
+                    recordBreakerResult(request.status);
+                    request.elapsedMs = millis() - slot.startedAt;
+                    request.bytes = slot.client.getRequestBytes();
+                    finishBatchRequest(request, slot);
+                    if(request.status == TS_OK_SUCCESS)
+                    {
+                        succeeded++;
+                    }
+                    slot.request = -1;
+                    busy--;
+                    progress = true;
+                }
+                if(!progress)
+                {
+                    delay(1);
+                }
             }
-            
-            textToSearch.remove(toPosition);
-            
-            return textToSearch.substring(fromPosition);
+            return succeeded;
         }
         
-        String parseValues(String & multiContent, String key)
+        // Connects one client of readBatch() and sends its request, false if the read already failed
+        bool startBatchRequest(Client & client, batchSlot & slot, readRequest & request, unsigned int requestIndex)
         {
-            if(multiContent.length() == 0){
-                return String("");
+            TS_LOG_INFO(TS_EVENT_READ_RAW, request.channelNumber, request.field);
+            request.response = "";
+            slot.startedAt = millis();
+            if(0 != request.field && (request.field < FIELDNUM_MIN || request.field > FIELDNUM_MAX))
+            {
+                request.status = TS_ERR_INVALID_FIELD_NUM;
+                request.elapsedMs = 0;
+                return false;
             }
-            
-            String searchPhrase = String("\"") + key + String("\":\"");
-            
-            int fromPosition = multiContent.indexOf(searchPhrase,0);
-            
-            if(fromPosition == -1){
-                // return because there is no status or it's null
-                return String("");
+            if(!checkDataBudget(false, TS_PRIORITY_NORMAL))
+            {
+                request.status = TS_ERR_BUDGET_EXCEEDED;
+                request.elapsedMs = 0;
+                return false;
+            }
+            if(!this->breaker.allowRequest())
+            {
+                request.status = TS_ERR_CIRCUIT_OPEN;
+                request.elapsedMs = 0;
+                return false;
+            }
+            if(!connectServer(client))
+            {
+                TS_LOG_ERROR(TS_EVENT_CONNECT_FAILED, this->port, 0);
+                request.status = TS_ERR_CONNECT_FAILED;
+                recordBreakerResult(request.status);
+                request.elapsedMs = millis() - slot.startedAt;
+                return false;
             }
             
-            fromPosition = fromPosition + searchPhrase.length();
-                    
-            int toPosition = multiContent.indexOf("\"", fromPosition);
+            bool sent = client.print("GET /channels/") && client.print(request.channelNumber);
+            if(0 != request.field)
+            {
+                sent = sent && client.print("/fields/") && client.print(request.field) && client.print("/last");
+            }
+            else if(NULL != request.URLSuffix && '\0' != request.URLSuffix[0])
+            {
+                sent = sent && client.print(request.URLSuffix);
+            }
+            sent = sent && client.print(" HTTP/1.1\r\n") && writeHTTPHeader(client, request.readAPIKey) && client.print("\r\n");
+            if(!sent)
+            {
+                client.stop();
+                TS_LOG_ERROR(TS_EVENT_ABORT, 0, 0);
+                request.status = TS_ERR_UNEXPECTED_FAIL;
+                recordBreakerResult(request.status);
+                request.elapsedMs = millis() - slot.startedAt;
+                return false;
+            }
             
+            slot.request = requestIndex;
+            slot.sentAt = millis();
+            slot.parser.begin(&request.response, &this->clock);
+            return true;
+        }
+        
+        void finishBatchRequest(readRequest & request, batchSlot &)
+        {
+            if(request.status != TS_OK_SUCCESS)
+            {
+                request.response = "";
+            }
+        }
+        
+        // Connects one client of writeBatch() and sends its update, false if the update was not sent
+        bool startBatchRequest(Client & client, batchSlot & slot, channelUpdate & update, unsigned int requestIndex)
+        {
+            slot.startedAt = millis();
+            update.entryID = 0;
+            update.elapsedMs = 0;
+            if(update.postMessage.length() == 0)
+            {
+                update.status = TS_ERR_SETFIELD_NOT_CALLED;
+                return false;
+            }
+            if(!checkDataBudget(false, TS_PRIORITY_NORMAL))
+            {
+                update.status = TS_ERR_BUDGET_EXCEEDED;
+                return false;
+            }
+            // While conserving data, each channel is written at most once per conserve interval
+            unsigned long minIntervalMs = update.minIntervalMs;
+            if(isConservingData() && minIntervalMs < this->dataBudget.getConserveInterval())
+            {
+                minIntervalMs = this->dataBudget.getConserveInterval();
+            }
+            if(update.written && slot.startedAt - update.lastWriteAt < minIntervalMs)
+            {
+                update.status = TS_ERR_RATE_LIMITED;
+                return false;
+            }
+            TS_LOG_TRACE(TS_EVENT_POST, update.channelNumber, update.postMessage.length());
+            if(!this->breaker.allowRequest())
+            {
+                update.status = TS_ERR_CIRCUIT_OPEN;
+                return false;
+            }
+            if(!connectServer(client))
+            {
+                TS_LOG_ERROR(TS_EVENT_CONNECT_FAILED, this->port, 0);
+                update.status = TS_ERR_CONNECT_FAILED;
+                recordBreakerResult(update.status);
+                update.elapsedMs = millis() - slot.startedAt;
+                return false;
+            }
             
-            if(toPosition == -1){
-                // return because there is no end quote
-                return String("");
+            bool sent = client.print("POST /update HTTP/1.1\r\n") && writeHTTPHeader(client, update.writeAPIKey);
+            sent = sent && client.print("Content-Type: application/x-www-form-urlencoded\r\n");
+            sent = sent && client.print("Content-Length: ") && client.print(update.postMessage.length() + strlen("&headers=false")) && client.print("\r\n\r\n");
+            sent = sent && client.print(update.postMessage) && client.print("&headers=false");
+            if(!sent)
+            {
+                client.stop();
+                TS_LOG_ERROR(TS_EVENT_ABORT, 1, 0);
+                update.status = TS_ERR_UNEXPECTED_FAIL;
+                recordBreakerResult(update.status);
+                update.elapsedMs = millis() - slot.startedAt;
+                return false;
             }
             
-            return multiContent.substring(fromPosition, toPosition);
+            slot.request = requestIndex;
+            slot.sentAt = millis();
+            slot.parser.begin(&update.response, &this->clock);
+            return true;
         }
         
-        int abortWriteRaw()
+        void finishBatchRequest(channelUpdate & update, batchSlot & slot)
         {
-            this->client->stop();
-            return TS_ERR_UNEXPECTED_FAIL;
+            if(update.status == TS_OK_SUCCESS)
+            {
+                update.entryID = update.response.toInt();
+                if(update.entryID == 0)
+                {
+                    // ThingSpeak did not accept the write
+                    update.status = TS_ERR_NOT_INSERTED;
+                }
+                else
+                {
+                    TS_LOG_INFO(TS_EVENT_ENTRY_ID, update.channelNumber, update.entryID);
+                    update.lastWriteAt = slot.startedAt;
+                    update.written = true;
+                    update.postMessage = "";
+                }
+            }
+            update.response = "";
         }
-
+        
         String abortReadRaw()
         {
             this->client->stop();
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, "ReadRaw abort - disconnected." , SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
+            TS_LOG_ERROR(TS_EVENT_ABORT, 0, 0);
+            recordBreakerResult(TS_ERR_UNEXPECTED_FAIL);
             this->lastReadStatus = TS_ERR_UNEXPECTED_FAIL;
             return String("");
         }
         
         void setPort(unsigned int port)
         {
+            if(port != this->port)
+            {
+                // A different endpoint starts with a closed circuit breaker
+                this->breaker.reset();
+            }
             this->port = port;
         }
         
         
         void setClient(Client * client)
         {
-            this->client = client;
+            // Requests go through the meter, which charges their bytes to the data budget
+            this->meteredClient.attach(client, &this->dataBudget);
+            this->client = &this->meteredClient;
+        }
+        
+        // Takes the priority set by setPriority() for the next write
+        uint8_t takeWritePriority()
+        {
+            uint8_t priority = this->nextWritePriority;
+            this->nextWritePriority = TS_PRIORITY_NORMAL;
+            return priority;
+        }
+        
+#if PLATFORM_THREADING
+        // Milliseconds the worker can wait for a request before it prepares the connection for the next write
+        system_tick_t autoPrepareWaitMs()
+        {
+            std::lock_guard<RecursiveMutex> lock(this->networkLock);
+            if(this->autoPrepareIntervalMs == 0 || this->autoPrepareDone)
+            {
+                return CONCURRENT_WAIT_FOREVER;
+            }
+            unsigned long sinceWrite = millis() - this->lastWriteStartedAt;
+            if(sinceWrite + this->autoPrepareLeadMs >= this->autoPrepareIntervalMs)
+            {
+                return 0;
+            }
+            return this->autoPrepareIntervalMs - this->autoPrepareLeadMs - sinceWrite;
+        }
+        
+        // Called by the worker when no request came within autoPrepareWaitMs()
+        void autoPrepare()
+        {
+            std::lock_guard<RecursiveMutex> lock(this->networkLock);
+            if(autoPrepareWaitMs() == 0)
+            {
+                this->autoPrepareDone = true;
+                prepare();
+            }
+        }
+#endif
+        
+        // Starts the deadline of one call: the one set by setDeadline(), else the time budget, else none
+        void beginOperation()
+        {
+            if(this->nextDeadlineSet)
+            {
+                this->operationDeadline = this->nextDeadline;
+                this->deadlineActive = true;
+                this->nextDeadlineSet = false;
+            }
+            else
+            {
+                this->operationDeadline = millis() + this->timeBudgetMs;
+                this->deadlineActive = (this->timeBudgetMs > 0);
+            }
+        }
+        
+        bool deadlinePassed()
+        {
+            return this->deadlineActive && (long)(millis() - this->operationDeadline) >= 0;
+        }
+        
+        // Milliseconds left before the deadline, at most cap
+        unsigned long timeLeft(unsigned long cap)
+        {
+            if(!this->deadlineActive)
+            {
+                return cap;
+            }
+            long remaining = (long)(this->operationDeadline - millis());
+            if(remaining <= 0)
+            {
+                return 0;
+            }
+            return ((unsigned long)remaining < cap) ? (unsigned long)remaining : cap;
+        }
+        
+        // Keeps each blocking read of the response inside the deadline
+        void limitStreamTimeout()
+        {
+            this->client->setTimeout(timeLeft(TS_STREAM_TIMEOUT_MS));
+        }
+        
+        bool isConservingData()
+        {
+            return this->dataBudget.getLevel() != TS_BUDGET_NORMAL;
+        }
+        
+        // True if the data budget allows the request, checked before connecting
+        bool checkDataBudget(bool write, uint8_t priority)
+        {
+            if(this->dataBudget.allowRequest(write, priority))
+            {
+                return true;
+            }
+            TS_LOG_WARN(TS_EVENT_BUDGET_EXCEEDED, this->dataBudget.getLevel(), this->dataBudget.getUsed());
+            return false;
         }
 
         Client * client = NULL;
         unsigned int port = THINGSPEAK_PORT_NUMBER;
-        String nextWriteField[8];
+        ThingSpeakCircuitBreaker breaker;
+        ThingSpeakDataBudget dataBudget;
+        ThingSpeakClock clock;               // Also set from the Date header of each response
+        ThingSpeakMeteredClient meteredClient;  // Wraps the client given to begin()
+#ifdef TS_WARM_START
+        IPAddress serverIP;                  // Resolved address of THINGSPEAK_URL, 0.0.0.0 until it is looked up
+        unsigned long lastWriteTime;         // UTC seconds of the last write ThingSpeak accepted
+        unsigned long feedReadTime;          // UTC seconds when lastFeed was read
+#endif
+        stagedValue nextWriteField[8];
+        uint8_t sampleReduction[8];
+        uint8_t fieldPriority[8];
+        uint8_t nextWritePriority;           // Set by setPriority() for the next write
+        unsigned long timeBudgetMs;          // Set by setTimeBudget(), 0 for no deadline
+        unsigned long nextDeadline;          // Set by setDeadline() for the next call
+        bool nextDeadlineSet;
+        unsigned long operationDeadline;     // millis() when the current call runs out of time
+        bool deadlineActive;
+        ThingSpeakStagingQueue<TS_STAGING_QUEUE_LENGTH> stagingQueue;
+        #ifndef TS_DISABLE_LOCATION
         float nextWriteLatitude;
         float nextWriteLongitude;
         float nextWriteElevation;
+        #endif
         int lastReadStatus;
-        String nextWriteStatus;
-        String nextWriteCreatedAt;
+        #ifndef TS_DISABLE_STATUS
+        tsStatusValue nextWriteStatus;
+        #endif
+        tsTimestampValue nextWriteCreatedAt;
+        #ifndef TS_DISABLE_READS
         feed lastFeed;
+        #endif
+#if TS_LOG_LEVEL > TS_LOG_LEVEL_NONE
+        ThingSpeakLog<TS_LOG_LENGTH> eventLog;
+#endif
+        long lastEntryID;
+        long entryHighWaterMark;
+        bool idempotentWrites;
+        bool fireAndForget;
+        bool writeInFlight;                  // A write sent by fire and forget is waiting for reapWrite()
+        unsigned long writeSentAt;           // When that write was sent
+        unsigned long confirmedWrites;
+        unsigned long failedWrites;
+        unsigned long unconfirmedWrites;
+        bool prepared;                       // client was connected by prepare() and has not been used yet
+        unsigned long preparedAt;
+        unsigned long autoPrepareIntervalMs; // Set by setAutoPrepare(), 0 when it is off
+        unsigned long autoPrepareLeadMs;
+        bool autoPrepareDone;                // The connection for the next write has been prepared, or tried
+        unsigned long lastWriteStartedAt;
+#ifdef TS_GZIP_RESPONSES
+        unsigned long lastResponseWireLength;
+#endif
+        const char * requestETag;            // Set by poll() while it reads
+        char * responseETag;
+        String pendingUpdate;                // Update kept by setIdempotentWrites() after an ambiguous failure
+        tsTimestampValue pendingCreatedAt;
+#if PLATFORM_THREADING
+        Thread * workerThread;
+        os_queue_t workerQueue;              // Indexes of queued workerRequests
+        RecursiveMutex networkLock;          // Held by the worker and by the blocking calls while they use the client
+        workerRequest workerRequests[TS_WORKER_QUEUE_LENGTH];
+        expiredCallback expiredCallbacks[TS_WORKER_QUEUE_LENGTH];
+        std::atomic<unsigned int> nextWorkerRequest;
+        std::atomic<unsigned long> workerSequence;
+#endif
 
-        bool connectThingSpeak()
+        int connectThingSpeak()
         {
             bool connectSuccess = false;
             
-            #ifdef PRINT_DEBUG_MESSAGES
-                Particle.publish(SPARK_PUBLISH_TOPIC, String("Connect to ThingSpeak URL: ") + String(THINGSPEAK_URL) + String(":") + String(this->port) + "..." , SPARK_PUBLISH_TTL, PRIVATE);
-                Serial.print(THINGSPEAK_URL);
-                Serial.print(":");
-                Serial.print(this->port);
-                Serial.print("...");
-            #endif
-            connectSuccess = client->connect(THINGSPEAK_URL, this->port);
+            if(this->prepared)
+            {
+                this->prepared = false;
+                if(millis() - this->preparedAt < TS_PREPARE_IDLE_MS && this->client->connected())
+                {
+                    TS_LOG_TRACE(TS_EVENT_CONNECTED, this->port, 1);
+                    return TS_OK_SUCCESS;
+                }
+                this->client->stop();
+            }
+            if(!this->breaker.allowRequest())
+            {
+                TS_LOG_TRACE(TS_EVENT_CIRCUIT_OPEN, this->port, this->breaker.getRetryIn());
+                return TS_ERR_CIRCUIT_OPEN;
+            }
+            TS_LOG_TRACE(TS_EVENT_CONNECT, this->port, 0);
+            connectSuccess = connectServer(*this->client);
             
-            #ifdef PRINT_DEBUG_MESSAGES
-            if (connectSuccess)
+            if(connectSuccess)
             {
-                Particle.publish(SPARK_PUBLISH_TOPIC, "Connection Success", SPARK_PUBLISH_TTL, PRIVATE);
+                TS_LOG_TRACE(TS_EVENT_CONNECTED, this->port, 0);
             }
             else
             {
-                Particle.publish(SPARK_PUBLISH_TOPIC, "Connection Failure", SPARK_PUBLISH_TTL, PRIVATE);
+                TS_LOG_ERROR(TS_EVENT_CONNECT_FAILED, this->port, 0);
+                recordBreakerResult(TS_ERR_CONNECT_FAILED);
             }
-            #endif
-            return connectSuccess;
+            return connectSuccess ? TS_OK_SUCCESS : TS_ERR_CONNECT_FAILED;
             
         };
+        
+        void recordBreakerResult(int status)
+        {
+            if(this->breaker.recordResult(status))
+            {
+                TS_LOG_WARN(TS_EVENT_CIRCUIT_OPEN, this->port, this->breaker.getRetryIn());
+            }
+        }
+
+        // Connects target to ThingSpeak, by the cached address when there is one
+        bool connectServer(Client & target)
+        {
+            #ifdef TS_WARM_START
+                if(!this->serverIP)
+                {
+                    this->serverIP = resolveServer();
+                }
+                if(this->serverIP)
+                {
+                    if(target.connect(this->serverIP, this->port))
+                    {
+                        return true;
+                    }
+                    // The address may have changed, so the next call looks it up again.  Trying the name now would
+                    // block for a second connect timeout when the server is simply unreachable.
+                    this->serverIP = IPAddress();
+                    return false;
+                }
+            #endif
+            return target.connect(THINGSPEAK_URL, this->port);
+        }
+
+#ifdef TS_WARM_START
+        IPAddress resolveServer()
+        {
+            #if Wiring_WiFi
+                return WiFi.resolve(THINGSPEAK_URL);
+            #elif Wiring_Cellular
+                return Cellular.resolve(THINGSPEAK_URL);
+            #else
+                return IPAddress();
+            #endif
+        }
+        
+        // Fletcher-32 of a snapshot, after its checksum
+        static uint32_t warmStateChecksum(const warmState & state)
+        {
+            const uint8_t * data = (const uint8_t *)&state.savedAt;
+            size_t length = sizeof(warmState) - offsetof(warmState, savedAt);
+            uint32_t sum1 = 0xFFFF;
+            uint32_t sum2 = 0xFFFF;
+            for(size_t i = 0; i < length; i++)
+            {
+                sum1 = (sum1 + data[i]) % 65535;
+                sum2 = (sum2 + sum1) % 65535;
+            }
+            return (sum2 << 16) | sum1;
+        }
+        
+        // Copies text into a fixed buffer of a snapshot, false if it had to be cut short
+        static bool copyWarmText(char * buffer, size_t capacity, const char * text)
+        {
+            size_t length = strlen(text);
+            bool fits = length <= capacity;
+            if(!fits)
+            {
+                length = capacity;
+            }
+            memcpy(buffer, text, length);
+            buffer[length] = '\0';
+            return fits;
+        }
+#endif
+
+        bool writeHTTPHeader(const char * APIKey)
+        {
+            return writeHTTPHeader(*this->client, APIKey);
+        };
 
-        bool writeHTTPHeader(const char * APIKey)
+        bool writeHTTPHeader(Client & target, const char * APIKey)
         {
             
-            if (!this->client->print("Host: api.thingspeak.com\r\n")) return false;
-            if (!this->client->print("Connection: close\r\n")) return false;
-            if (!this->client->print("User-Agent: ")) return false;
-            if (!this->client->print(TS_USER_AGENT)) return false;
-            if (!this->client->print("\r\n")) return false;
+            if (!target.print("Host: api.thingspeak.com\r\n")) return false;
+            if (!target.print("Connection: close\r\n")) return false;
+            if (!target.print("User-Agent: ")) return false;
+            if (!target.print(TS_USER_AGENT)) return false;
+            if (!target.print("\r\n")) return false;
             if(NULL != APIKey)
             {
-                if (!this->client->print("X-THINGSPEAKAPIKEY: ")) return false;
-                if (!this->client->print(APIKey)) return false;
-                if (!this->client->print("\r\n")) return false;
+                if (!target.print("X-THINGSPEAKAPIKEY: ")) return false;
+                if (!target.print(APIKey)) return false;
+                if (!target.print("\r\n")) return false;
             }
             return true;
         };
@@ -1496,65 +6442,177 @@
         int getHTTPResponse(String & response)
         {
             unsigned long startWaitForResponseAt = millis();
-            while(client->available() == 0 && millis() - startWaitForResponseAt < TIMEOUT_MS_SERVERRESPONSE)
+            unsigned long waitLimit = timeLeft(TIMEOUT_MS_SERVERRESPONSE);
+            while(client->available() == 0 && millis() - startWaitForResponseAt < waitLimit)
             {
-                delay(100);
+                delay(timeLeft(100));
             }
             if(client->available() == 0)
             {
-                return TS_ERR_TIMEOUT; // Didn't get server response in time
+                TS_LOG_WARN(TS_EVENT_TIMEOUT, millis() - startWaitForResponseAt, 0);
+                return deadlinePassed() ? TS_ERR_DEADLINE_EXCEEDED : TS_ERR_TIMEOUT; // Didn't get server response in time
             }
 
+            limitStreamTimeout();
             if(!client->find(const_cast<char *>("HTTP/1.1")))
             {
-                #ifdef PRINT_HTTP
-                    Particle.publish(SPARK_PUBLISH_TOPIC, "ERROR: Didn't find HTTP/1.1", SPARK_PUBLISH_TTL, PRIVATE);
-                #endif
-                return TS_ERR_BAD_RESPONSE; // Couldn't parse response (didn't find HTTP/1.1)
+                TS_LOG_ERROR(TS_EVENT_BAD_RESPONSE, 1, 0);
+                return deadlinePassed() ? TS_ERR_DEADLINE_EXCEEDED : TS_ERR_BAD_RESPONSE; // Couldn't parse response (didn't find HTTP/1.1)
             }
+            limitStreamTimeout();
             int status = client->parseInt();
-            #ifdef PRINT_HTTP
-                Particle.publish(SPARK_PUBLISH_TOPIC, "Got Status of " + String(status), SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
+            TS_LOG_TRACE(TS_EVENT_HTTP_STATUS, status, 0);
             if(status != TS_OK_SUCCESS)
             {
                 return status;
             }
 
+            limitStreamTimeout();
             if(!client->find(const_cast<char *>("\r\n")))
             {
-                #ifdef PRINT_HTTP
-                    Particle.publish(SPARK_PUBLISH_TOPIC, "ERROR: Didn't find end of status line", SPARK_PUBLISH_TTL, PRIVATE);
-                #endif
-                return TS_ERR_BAD_RESPONSE;
+                TS_LOG_ERROR(TS_EVENT_BAD_RESPONSE, 2, 0);
+                return deadlinePassed() ? TS_ERR_DEADLINE_EXCEEDED : TS_ERR_BAD_RESPONSE;
             }
-            #ifdef PRINT_HTTP
-                Particle.publish(SPARK_PUBLISH_TOPIC, "Found end of status line", SPARK_PUBLISH_TTL, PRIVATE);
+
+            // Under a deadline the body is read up to its length, readString() would wait out the stream timeout
+            bool readBody = this->deadlineActive;
+            #ifdef TS_GZIP_RESPONSES
+                readBody = true;
             #endif
+            if(readBody)
+            {
+                int bodyStatus = readResponseBody(response);
+                return (bodyStatus == TS_OK_SUCCESS) ? status : bodyStatus;
+            }
 
-            if(!client->find(const_cast<char *>("\n\r\n")))
+            // Read the headers one line at a time, for the Date that sets the clock and the ETag poll() needs
+            responseHeaders headers;
+            if(!readResponseHeaders(headers))
             {
-                #ifdef PRINT_HTTP
-                    Particle.publish(SPARK_PUBLISH_TOPIC, "ERROR: Didn't find end of header", SPARK_PUBLISH_TTL, PRIVATE);
-                #endif
+                TS_LOG_ERROR(TS_EVENT_BAD_RESPONSE, 3, 0);
                 return TS_ERR_BAD_RESPONSE;
             }
-            #ifdef PRINT_HTTP
-                Particle.publish(SPARK_PUBLISH_TOPIC, "Found end of header", SPARK_PUBLISH_TTL, PRIVATE);
-            #endif
             // This is a workaround to a bug in the Spark implementation of String
             String tempString = client->readString();
             response = tempString;
-            #ifdef PRINT_HTTP
-                Particle.publish(SPARK_PUBLISH_TOPIC, "Response: \"" + tempString + "\"", SPARK_PUBLISH_TTL, PRIVATE);
+            TS_LOG_TRACE(TS_EVENT_RESPONSE, status, tempString.length());
+            return status;
+        };
+
+        // Reads the headers, then the body straight into response, decoding it if it is compressed
+        int readResponseBody(String & response)
+        {
+            responseHeaders headers;
+            if(!readResponseHeaders(headers))
+            {
+                return deadlinePassed() ? TS_ERR_DEADLINE_EXCEEDED : TS_ERR_BAD_RESPONSE;
+            }
+
+            ThingSpeakBodyReader body(*this->client, headers.chunked, headers.contentLength);
+            if(this->deadlineActive)
+            {
+                body.setDeadline(this->operationDeadline);
+            }
+            ThingSpeakStringPrinter decoded(response);
+            response = "";
+            bool success = true;
+            #ifdef TS_GZIP_RESPONSES
+                if(headers.gzip)
+                {
+                    // The window and code tables are only on the heap while a compressed body is decoded
+                    ThingSpeakInflater<TS_INFLATE_WINDOW_SIZE> * inflater = new (std::nothrow) ThingSpeakInflater<TS_INFLATE_WINDOW_SIZE>();
+                    if(NULL == inflater)
+                    {
+                        TS_LOG_ERROR(TS_EVENT_BAD_RESPONSE, 4, 0);
+                        return TS_ERR_OUT_OF_MEMORY;
+                    }
+                    success = (inflater->gunzip(body, decoded) == TS_INFLATE_OK);
+                    delete inflater;
+                }
+                else
+            #endif
+            {
+                int next;
+                while((next = body.read()) >= 0)
+                {
+                    decoded.write((uint8_t)next);
+                }
+            }
+            #ifdef TS_GZIP_RESPONSES
+                this->lastResponseWireLength = body.getWireLength();
             #endif
+            int status = body.isExpired() ? TS_ERR_DEADLINE_EXCEEDED : success ? TS_OK_SUCCESS : TS_ERR_BAD_RESPONSE;
+            TS_LOG_TRACE(TS_EVENT_RESPONSE, status, response.length());
             return status;
+        }
+
+        // Reads the response headers up to the blank line, setting the clock from the Date and keeping the ETag if poll() asked for it
+        bool readResponseHeaders(responseHeaders & headers)
+        {
+            headers.gzip = false;
+            headers.chunked = false;
+            headers.contentLength = -1;
+            if(NULL != this->responseETag)
+            {
+                this->responseETag[0] = '\0';
+            }
+            while(true)
+            {
+                limitStreamTimeout();
+                String line = this->client->readStringUntil('\n');
+                if(line.length() == 0)
+                {
+                    // Timed out before the end of the headers
+                    return false;
+                }
+                line.trim();
+                if(line.length() == 0)
+                {
+                    break;
+                }
+                int colon = line.indexOf(':');
+                if(colon < 0)
+                {
+                    continue;
+                }
+                String name = line.substring(0, colon);
+                name.toLowerCase();
+                String value = line.substring(colon + 1);
+                value.trim();
+                if(name == "content-encoding")
+                {
+                    headers.gzip = (value.indexOf("gzip") >= 0);
+                }
+                else if(name == "transfer-encoding")
+                {
+                    headers.chunked = (value.indexOf("chunked") >= 0);
+                }
+                else if(name == "content-length")
+                {
+                    headers.contentLength = value.toInt();
+                }
+                else if(name == "date")
+                {
+                    this->clock.sync(value.c_str(), millis());
+                }
+                else if(name == "etag" && NULL != this->responseETag && value.length() <= TS_ETAG_LENGTH)
+                {
+                    strcpy(this->responseETag, value.c_str());
+                }
+            }
+            return true;
+        }
+
+        #ifndef TS_DISABLE_FLOAT
+        bool isFloatInRange(float value)
+        {
+            // Supported range is -999999000000 to 999999000000
+            return !(0 == isinf(value) && (value > 999999000000 || value < -999999000000));
         };
 
         int convertFloatToChar(float value, char *valueString)
         {
-            // Supported range is -999999000000 to 999999000000
-            if(0 == isinf(value) && (value > 999999000000 || value < -999999000000))
+            if(!isFloatInRange(value))
             {
                 // Out of range
                 return TS_ERR_OUT_OF_RANGE;
@@ -1564,12 +6622,18 @@
 
             return TS_OK_SUCCESS;
         };
+        #endif
 
         float convertStringToFloat(String value)
+        {
+            return convertCharArrayToFloat(value.c_str());
+        };
+
+        float convertCharArrayToFloat(const char * value)
         {
             // There's a bug in the AVR function strtod that it doesn't decode -INF correctly (it maps it to INF)
-            float result = value.toFloat();
-            if(1 == isinf(result) && *value.c_str() == '-')
+            float result = atof(value);
+            if(1 == isinf(result) && *value == '-')
             {
                 result = (float)-INFINITY;
             }
@@ -1580,16 +6644,402 @@
         {
             for(size_t iField = 0; iField < 8; iField++)
             {
-                this->nextWriteField[iField] = "";
+                this->nextWriteField[iField].type = TS_VALUE_NONE;
+                this->nextWriteField[iField].text = "";
             }
+            #ifndef TS_DISABLE_LOCATION
             this->nextWriteLatitude = NAN;
             this->nextWriteLongitude = NAN;
             this->nextWriteElevation = NAN;
+            #endif
+            #ifndef TS_DISABLE_STATUS
             this->nextWriteStatus = "";
+            #endif
             this->nextWriteCreatedAt = "";
         };
     };
 
+
+    #ifndef TS_VIRTUAL_READ_RESULTS
+        #define TS_VIRTUAL_READ_RESULTS    4       // Entries read from each shard to find one written to all of them
+    #endif
+
+    // A channel of SHARDS x 8 fields, stored as one physical channel for each 8 fields.  Logical field n is field
+    // ((n - 1) % 8) + 1 of shard (n - 1) / 8.  Every shard of a write gets the same created-at timestamp, which is
+    // how read() finds the shards that belong together.  With TS_COMPACT_STORAGE, each value read is kept in a slot
+    // of TS_COMPACT_FIELD_LENGTH (32) bytes, and read() returns -101 when it had to cut a longer one.
+    template <unsigned int SHARDS>
+    class ThingSpeakVirtualChannel
+    {
+      public:
+        ThingSpeakVirtualChannel(ThingSpeakClass & thingSpeak) : thingSpeak(thingSpeak)
+        {
+            for(unsigned int shard = 0; shard < SHARDS; shard++)
+            {
+                this->thingSpeak.beginChannelUpdate(this->shards[shard], 0, NULL, TS_RATE_LIMIT_MS);
+                this->readAPIKeys[shard] = NULL;
+            }
+            clearFields();
+        }
+        
+        /*
+        Function: setShard
+        
+        Summary:
+        Set the physical channel that stores a group of 8 fields.
+        
+        Parameters:
+        shard - Shard number, 0 for fields 1-8, 1 for fields 9-16, and so on
+        channelNumber - Channel number
+        writeAPIKey - Write API key associated with the channel.  Must stay valid while the virtual channel is used.
+        readAPIKey - Read API key associated with the channel, or NULL for a public channel
+        minIntervalMs - Shortest time between updates of the channel, TS_RATE_LIMIT_MS for a free account
+        */
+        void setShard(unsigned int shard, unsigned long channelNumber, const char * writeAPIKey, const char * readAPIKey, unsigned long minIntervalMs)
+        {
+            if(shard >= SHARDS)
+            {
+                return;
+            }
+            this->thingSpeak.beginChannelUpdate(this->shards[shard], channelNumber, writeAPIKey, minIntervalMs);
+            this->readAPIKeys[shard] = readAPIKey;
+        }
+        
+        /*
+        Function: setField
+        
+        Summary:
+        Set the value of a field for the next write().
+        
+        Parameters:
+        field - Field number (1 to 8 x SHARDS)
+        value - Integer, long, floating point or string value to write
+        
+        Returns:
+        200 - OK / Success
+        -101 - Value is out of range or string is too long
+        -201 - Invalid field number specified
+        */
+        int setField(unsigned int field, int value)
+        {
+            return setField(field, (long)value);
+        }
+        
+        int setField(unsigned int field, long value)
+        {
+            if(field < FIELDNUM_MIN || field > SHARDS * FIELDNUM_MAX) return TS_ERR_INVALID_FIELD_NUM;
+            this->nextWriteField[field - 1].type = TS_VALUE_LONG;
+            this->nextWriteField[field - 1].longValue = value;
+            return TS_OK_SUCCESS;
+        }
+        
+        #ifndef TS_DISABLE_FLOAT
+        int setField(unsigned int field, float value)
+        {
+            if(field < FIELDNUM_MIN || field > SHARDS * FIELDNUM_MAX) return TS_ERR_INVALID_FIELD_NUM;
+            if(!this->thingSpeak.isFloatInRange(value)) return TS_ERR_OUT_OF_RANGE;
+            this->nextWriteField[field - 1].type = TS_VALUE_FLOAT;
+            this->nextWriteField[field - 1].floatValue = value;
+            return TS_OK_SUCCESS;
+        }
+        #else
+        // Compiled out by TS_DISABLE_FLOAT, pass a long or a string instead
+        int setField(unsigned int field, float value) = delete;
+        int setField(unsigned int field, double value) = delete;
+        #endif
+        
+        int setField(unsigned int field, const char * value)
+        {
+            if(field < FIELDNUM_MIN || field > SHARDS * FIELDNUM_MAX) return TS_ERR_INVALID_FIELD_NUM;
+            if(NULL == value || strlen(value) > TS_FIELD_VALUE_MAX) return TS_ERR_OUT_OF_RANGE;
+            this->nextWriteField[field - 1].type = (*value == '\0') ? TS_VALUE_NONE : TS_VALUE_TEXT;
+            this->nextWriteField[field - 1].text = value;
+            return TS_OK_SUCCESS;
+        }
+        
+        int setField(unsigned int field, String value)
+        {
+            return setField(field, value.c_str());
+        }
+        
+        /*
+        Function: write
+        
+        Summary:
+        Write the fields set since the last write, sending the shards that have values at the same time.
+        
+        Parameters:
+        clients - Array of clients to write over, for example TCPClient objects created earlier in the sketch
+        clientCount - Number of clients, at most TS_READ_POOL_MAX are used
+        
+        Returns:
+        200 if every shard with values was stored, otherwise the status of the first shard that was not.  Use getShardStatus() for each shard.
+        
+        Notes:
+        Uses the multi-field update of the ThingSpeak object, so do not stage values there at the same time.  The shards are stamped with the current time, so the time must be known (see getTime()) for read() to match them up.  A shard held back by its rate limit (-402) is sent with the next write, unless that write has new values for it.
+        */
+        int write(Client ** clients, unsigned int clientCount)
+        {
+            char timestamp[24];
+            bool stamped = this->thingSpeak.clock.isValid();
+            if(stamped)
+            {
+                this->thingSpeak.formatUTCTimestamp(this->thingSpeak.clock.now(), timestamp, sizeof(timestamp));
+            }
+            
+            bool staged[SHARDS];
+            bool any = false;
+            for(unsigned int shard = 0; shard < SHARDS; shard++)
+            {
+                staged[shard] = false;
+                for(unsigned int field = 0; field < FIELDNUM_MAX; field++)
+                {
+                    stagedValue & value = this->nextWriteField[shard * FIELDNUM_MAX + field];
+                    if(value.type == TS_VALUE_LONG)
+                    {
+                        this->thingSpeak.setField(field + 1, value.longValue);
+                    }
+                    #ifndef TS_DISABLE_FLOAT
+                    else if(value.type == TS_VALUE_FLOAT)
+                    {
+                        this->thingSpeak.setField(field + 1, value.floatValue);
+                    }
+                    #endif
+                    else if(value.type == TS_VALUE_TEXT)
+                    {
+                        this->thingSpeak.setField(field + 1, value.text.c_str());
+                    }
+                    else
+                    {
+                        continue;
+                    }
+                    staged[shard] = true;
+                }
+                if(staged[shard])
+                {
+                    if(stamped)
+                    {
+                        this->thingSpeak.setCreatedAt(timestamp);
+                    }
+                    this->thingSpeak.stageChannelUpdate(this->shards[shard]);
+                    any = true;
+                }
+                // A shard left from an earlier write is still sent
+                staged[shard] = staged[shard] || this->shards[shard].postMessage.length() > 0;
+            }
+            clearFields();
+            if(!any)
+            {
+                return TS_ERR_SETFIELD_NOT_CALLED;
+            }
+            
+            this->thingSpeak.writeBatch(this->shards, SHARDS, clients, clientCount);
+            for(unsigned int shard = 0; shard < SHARDS; shard++)
+            {
+                if(staged[shard] && this->shards[shard].status != TS_OK_SUCCESS)
+                {
+                    return this->shards[shard].status;
+                }
+            }
+            return TS_OK_SUCCESS;
+        }
+        
+        /*
+        Function: getShardStatus
+        
+        Summary:
+        Get the result of the last write() for one shard.
+        
+        Parameters:
+        shard - Shard number
+        
+        Returns:
+        The same values as writeFields(), -210 if the shard had no values, or -402 if it was held back by its rate limit.
+        */
+        int getShardStatus(unsigned int shard)
+        {
+            return (shard < SHARDS) ? this->shards[shard].status : TS_ERR_INVALID_FIELD_NUM;
+        }
+        
+        #ifndef TS_DISABLE_READS
+        /*
+        Function: read
+        
+        Summary:
+        Read the latest entry that was written to every shard, reading all the shards at the same time.
+        
+        Parameters:
+        clients - Array of clients to read over, for example TCPClient objects created earlier in the sketch
+        clientCount - Number of clients, at most TS_READ_POOL_MAX are used
+        
+        Returns:
+        200 - OK / Success, use getFieldAsString() and the other get functions for the values
+        -101 - The entry was found, but a value was longer than TS_COMPACT_FIELD_LENGTH and was cut to it (TS_COMPACT_STORAGE only)
+        -404 - None of the last TS_VIRTUAL_READ_RESULTS entries of the first shard is in all the other shards
+        Other values are errors reading a shard, the same as getLastReadStatus().
+        */
+        int read(Client ** clients, unsigned int clientCount)
+        {
+            static const char * const URLSuffix = "/feeds.csv?results=" TS_STRINGIFY(TS_VIRTUAL_READ_RESULTS);
+            readRequest requests[SHARDS];
+            for(unsigned int shard = 0; shard < SHARDS; shard++)
+            {
+                requests[shard].channelNumber = this->shards[shard].channelNumber;
+                requests[shard].field = 0;
+                requests[shard].URLSuffix = URLSuffix;
+                requests[shard].readAPIKey = this->readAPIKeys[shard];
+            }
+            if(this->thingSpeak.readBatch(requests, SHARDS, clients, clientCount) != SHARDS)
+            {
+                for(unsigned int shard = 0; shard < SHARDS; shard++)
+                {
+                    if(requests[shard].status != TS_OK_SUCCESS)
+                    {
+                        return requests[shard].status;
+                    }
+                }
+            }
+            
+            // Entries of the first shard, oldest first
+            String candidates[TS_VIRTUAL_READ_RESULTS];
+            unsigned int candidateCount = 0;
+            int8_t columnFields[TS_CSV_COLUMNS_MAX];
+            unsigned int columns;
+            unsigned int position = 0;
+            String createdAt;
+            this->thingSpeak.readCSVHeader(requests[0].response, position, columnFields, columns);
+            while(candidateCount < TS_VIRTUAL_READ_RESULTS && this->thingSpeak.nextCSVRecord(requests[0].response, position, columnFields, columns, createdAt, NULL))
+            {
+                candidates[candidateCount++] = createdAt;
+            }
+            
+            // Take the newest entry found in every shard
+            String values[FIELDNUM_MAX];
+            for(int candidate = (int)candidateCount - 1; candidate >= 0; candidate--)
+            {
+                bool truncated = false;
+                unsigned int shard;
+                for(shard = 0; shard < SHARDS; shard++)
+                {
+                    if(!findShardRecord(requests[shard].response, candidates[candidate], values))
+                    {
+                        break;
+                    }
+                    for(unsigned int field = 0; field < FIELDNUM_MAX; field++)
+                    {
+                        // Only a compact slot can be shorter than a value ThingSpeak stores
+                        truncated = truncated || values[field].length() > TS_FIELD_VALUE_MAX;
+                        this->lastReadField[shard * FIELDNUM_MAX + field] = values[field].c_str();
+                    }
+                }
+                if(shard == SHARDS)
+                {
+                    this->lastReadCreatedAt = candidates[candidate].c_str();
+                    return truncated ? TS_ERR_OUT_OF_RANGE : TS_OK_SUCCESS;
+                }
+            }
+            clearReadFields();
+            return TS_ERR_SHARDS_MISMATCH;
+        }
+        
+        /*
+        Function: getFieldAsString
+        
+        Summary:
+        Fetch a field of the entry found by read().
+        
+        Parameters:
+        field - Field number (1 to 8 x SHARDS)
+        
+        Returns:
+        Value of the field, or empty if the field is not valid or has no value.
+        */
+        String getFieldAsString(unsigned int field)
+        {
+            return String(getFieldAsCharArray(field));
+        }
+        
+        const char * getFieldAsCharArray(unsigned int field)
+        {
+            if(field < FIELDNUM_MIN || field > SHARDS * FIELDNUM_MAX) return "";
+            return this->lastReadField[field - 1].c_str();
+        }
+        
+        float getFieldAsFloat(unsigned int field)
+        {
+            return this->thingSpeak.convertCharArrayToFloat(getFieldAsCharArray(field));
+        }
+        
+        long getFieldAsLong(unsigned int field)
+        {
+            return atol(getFieldAsCharArray(field));
+        }
+        
+        // Created-at timestamp shared by the shards of the entry found by read()
+        String getCreatedAt()
+        {
+            return String(this->lastReadCreatedAt.c_str());
+        }
+        #endif
+        
+      private:
+        #ifndef TS_DISABLE_READS
+        // Finds the record created at createdAt in a shard's CSV feed
+        bool findShardRecord(String & csvContent, const String & createdAt, String * values)
+        {
+            int8_t columnFields[TS_CSV_COLUMNS_MAX];
+            unsigned int columns;
+            unsigned int position = 0;
+            String recordCreatedAt;
+            this->thingSpeak.readCSVHeader(csvContent, position, columnFields, columns);
+            while(true)
+            {
+                for(unsigned int field = 0; field < FIELDNUM_MAX; field++)
+                {
+                    values[field] = "";
+                }
+                if(!this->thingSpeak.nextCSVRecord(csvContent, position, columnFields, columns, recordCreatedAt, values))
+                {
+                    return false;
+                }
+                if(recordCreatedAt == createdAt)
+                {
+                    return true;
+                }
+            }
+        }
+        #endif
+        
+        void clearFields()
+        {
+            for(unsigned int field = 0; field < SHARDS * FIELDNUM_MAX; field++)
+            {
+                this->nextWriteField[field].type = TS_VALUE_NONE;
+                this->nextWriteField[field].text = "";
+            }
+        }
+        
+        #ifndef TS_DISABLE_READS
+        void clearReadFields()
+        {
+            for(unsigned int field = 0; field < SHARDS * FIELDNUM_MAX; field++)
+            {
+                this->lastReadField[field] = "";
+            }
+            this->lastReadCreatedAt = "";
+        }
+        #endif
+        
+        ThingSpeakClass & thingSpeak;
+        channelUpdate shards[SHARDS];
+        const char * readAPIKeys[SHARDS];
+        stagedValue nextWriteField[SHARDS * FIELDNUM_MAX];
+        #ifndef TS_DISABLE_READS
+        tsFieldValue lastReadField[SHARDS * FIELDNUM_MAX];
+        tsTimestampValue lastReadCreatedAt;
+        #endif
+    };
+
     extern ThingSpeakClass ThingSpeak;
 
 #endif //ThingSpeak_h
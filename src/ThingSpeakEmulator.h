@@ -0,0 +1,888 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  Local stand-in for the ThingSpeak service, for testing sketches and fleet settings without using the real
+  service.  The emulator runs on the device, inside the sketch, and keeps a few recent entries of each channel in RAM and answers the requests the library
+  sends, with configurable latency, failures and rate limit.  ThingSpeakEmulatedClient is a Client that talks
+  to the emulator instead of the network, so it can be passed to begin(), readBatch() and writeBatch().
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#ifndef ThingSpeakEmulator_h
+    #define ThingSpeakEmulator_h
+
+    #include "ThingSpeak.h"
+
+    #ifndef TS_EMULATOR_CHANNELS
+        #define TS_EMULATOR_CHANNELS       16      // Channels the emulator can hold
+    #endif
+    #ifndef TS_EMULATOR_FEED_LENGTH
+        #define TS_EMULATOR_FEED_LENGTH    8       // Most recent entries kept of each channel
+    #endif
+
+    // One stored entry of an emulated channel, empty strings are null values
+    typedef struct emulatedEntryRecord
+    {
+        long entryID;
+        time_t createdAt;
+        String fields[8];
+        String status;
+        String latitude;
+        String longitude;
+        String elevation;
+    }emulatedEntry;
+
+    // One emulated channel, entry n is kept in entries[(n - 1) % TS_EMULATOR_FEED_LENGTH]
+    typedef struct emulatedChannelRecord
+    {
+        unsigned long channelNumber;           // 0 for a free slot
+        const char * writeAPIKey;
+        const char * readAPIKey;               // NULL for a public channel
+        long lastEntryID;
+        unsigned long lastUpdateAt;            // millis() of the last accepted update
+        emulatedEntry entries[TS_EMULATOR_FEED_LENGTH];
+    }emulatedChannel;
+
+    // Answers the HTTP requests of ThingSpeakEmulatedClient the way api.thingspeak.com does
+    class ThingSpeakEmulator
+    {
+      public:
+        ThingSpeakEmulator()
+        {
+            for(size_t i = 0; i < TS_EMULATOR_CHANNELS; i++)
+            {
+                this->channels[i].channelNumber = 0;
+            }
+            this->minLatencyMs = 0;
+            this->maxLatencyMs = 0;
+            this->connectFailPercent = 0;
+            this->errorPercent = 0;
+            this->dropPercent = 0;
+            this->rateLimitMs = TS_RATE_LIMIT_MS;
+            resetCounts();
+        }
+
+        // Adds a channel, false if TS_EMULATOR_CHANNELS channels are already added.  The keys are not copied.
+        bool addChannel(unsigned long channelNumber, const char * writeAPIKey, const char * readAPIKey)
+        {
+            for(size_t i = 0; i < TS_EMULATOR_CHANNELS; i++)
+            {
+                emulatedChannel & channel = this->channels[i];
+                if(channel.channelNumber == 0 || channel.channelNumber == channelNumber)
+                {
+                    channel.channelNumber = channelNumber;
+                    channel.writeAPIKey = writeAPIKey;
+                    channel.readAPIKey = readAPIKey;
+                    channel.lastEntryID = 0;
+                    channel.lastUpdateAt = 0;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Each response arrives a random time between minMs and maxMs after the request
+        void setLatency(unsigned long minMs, unsigned long maxMs)
+        {
+            this->minLatencyMs = minMs;
+            this->maxLatencyMs = (maxMs < minMs) ? minMs : maxMs;
+        }
+
+        // Percent of connections refused, of requests answered with 500, and of requests never answered
+        void setFailures(unsigned int connectFailPercent, unsigned int errorPercent, unsigned int dropPercent)
+        {
+            this->connectFailPercent = connectFailPercent;
+            this->errorPercent = errorPercent;
+            this->dropPercent = dropPercent;
+        }
+
+        // Shortest time between updates of a channel, TS_RATE_LIMIT_MS by default, 0 for no limit
+        void setRateLimit(unsigned long intervalMs)
+        {
+            this->rateLimitMs = intervalMs;
+        }
+
+        emulatedChannel * getChannel(unsigned long channelNumber)
+        {
+            for(size_t i = 0; i < TS_EMULATOR_CHANNELS; i++)
+            {
+                if(this->channels[i].channelNumber == channelNumber && channelNumber != 0)
+                {
+                    return &this->channels[i];
+                }
+            }
+            return NULL;
+        }
+
+        void resetCounts()
+        {
+            this->connections = 0;
+            this->refusedConnections = 0;
+            this->requests = 0;
+            this->entriesStored = 0;
+            this->rateLimited = 0;
+            this->errors = 0;
+            this->dropped = 0;
+        }
+
+        unsigned long getConnections() { return this->connections; }
+        unsigned long getRefusedConnections() { return this->refusedConnections; }
+        unsigned long getRequests() { return this->requests; }
+        unsigned long getEntriesStored() { return this->entriesStored; }
+        unsigned long getRateLimited() { return this->rateLimited; }
+        unsigned long getErrors() { return this->errors; }
+        unsigned long getDropped() { return this->dropped; }
+
+        // Used by ThingSpeakEmulatedClient when it connects
+        bool acceptConnection()
+        {
+            if(chance(this->connectFailPercent))
+            {
+                this->refusedConnections++;
+                return false;
+            }
+            this->connections++;
+            return true;
+        }
+
+        // Used by ThingSpeakEmulatedClient for the time until the response arrives
+        unsigned long pickLatency()
+        {
+            if(this->maxLatencyMs <= this->minLatencyMs)
+            {
+                return this->minLatencyMs;
+            }
+            return this->minLatencyMs + random(this->maxLatencyMs - this->minLatencyMs + 1);
+        }
+
+        // Answers one complete request, false if it is dropped without a response
+        bool respond(const String & request, String & response)
+        {
+            this->requests++;
+            if(chance(this->dropPercent))
+            {
+                this->dropped++;
+                return false;
+            }
+            if(chance(this->errorPercent))
+            {
+                this->errors++;
+                response = httpResponse(500, "text/plain", "");
+                return true;
+            }
+
+            int lineEnd = request.indexOf("\r\n");
+            int headersEnd = request.indexOf("\r\n\r\n");
+            String requestLine = request.substring(0, lineEnd);
+            int methodEnd = requestLine.indexOf(' ');
+            String method = requestLine.substring(0, methodEnd);
+            String target = requestLine.substring(methodEnd + 1, requestLine.lastIndexOf(' '));
+            String query = String("");
+            int queryStart = target.indexOf('?');
+            if(queryStart >= 0)
+            {
+                query = target.substring(queryStart + 1);
+                target.remove(queryStart);
+            }
+            String headers = request.substring(lineEnd + 2, headersEnd + 2);
+            String body = request.substring(headersEnd + 4);
+            String apiKey = headerValue(headers, "x-thingspeakapikey");
+
+            if(method == "POST" && target == "/update")
+            {
+                if(apiKey.length() == 0)
+                {
+                    apiKey = formValue(body, "api_key");
+                }
+                response = respondUpdate(body, apiKey);
+            }
+            else if(method == "POST" && target.startsWith("/channels/") && target.endsWith("/bulk_update.json"))
+            {
+                response = respondBulkUpdate(target.substring(10).toInt(), body);
+            }
+            else if(method == "GET" && target.startsWith("/channels/"))
+            {
+                if(apiKey.length() == 0)
+                {
+                    apiKey = formValue(query, "api_key");
+                }
+                response = respondRead(target, query, apiKey);
+            }
+            else
+            {
+                response = httpResponse(404, "text/plain", "-1");
+            }
+            return true;
+        }
+
+      private:
+        // POST /update, answers the entry ID, or 0 if the update was not stored
+        String respondUpdate(const String & body, const String & apiKey)
+        {
+            emulatedChannel * channel = NULL;
+            for(size_t i = 0; i < TS_EMULATOR_CHANNELS && NULL == channel; i++)
+            {
+                if(this->channels[i].channelNumber != 0 && apiKey == this->channels[i].writeAPIKey)
+                {
+                    channel = &this->channels[i];
+                }
+            }
+            if(NULL == channel)
+            {
+                return httpResponse(400, "text/plain", "-1");
+            }
+            if(isRateLimited(*channel))
+            {
+                this->rateLimited++;
+                return httpResponse(200, "text/plain", "0");
+            }
+
+            emulatedEntry & entry = storeEntry(*channel, formValue(body, "created_at"));
+            for(unsigned int field = 1; field <= 8; field++)
+            {
+                entry.fields[field - 1] = formValue(body, String("field") + String(field));
+            }
+            entry.status = formValue(body, "status");
+            entry.latitude = formValue(body, "lat");
+            entry.longitude = formValue(body, "long");
+            entry.elevation = formValue(body, "elevation");
+            return httpResponse(200, "text/plain", String(entry.entryID));
+        }
+
+        // POST /channels/<channel>/bulk_update.json with {"write_api_key":"...","updates":[{...},...]}
+        String respondBulkUpdate(unsigned long channelNumber, const String & body)
+        {
+            emulatedChannel * channel = getChannel(channelNumber);
+            if(NULL == channel || jsonValue(body, "write_api_key") != channel->writeAPIKey)
+            {
+                return httpResponse(401, "application/json", "{\"status\":\"401\",\"error\":{\"error_code\":\"error_auth_required\"}}");
+            }
+            if(isRateLimited(*channel))
+            {
+                this->rateLimited++;
+                return httpResponse(429, "application/json", "{\"status\":\"429\",\"error\":{\"error_code\":\"error_too_many_requests\"}}");
+            }
+
+            int position = body.indexOf("\"updates\"");
+            if(position < 0)
+            {
+                return httpResponse(400, "application/json", "{\"status\":\"400\"}");
+            }
+            while((position = body.indexOf('{', position)) >= 0)
+            {
+                int end = body.indexOf('}', position);
+                if(end < 0)
+                {
+                    break;
+                }
+                String update = body.substring(position, end + 1);
+                emulatedEntry & entry = storeEntry(*channel, jsonValue(update, "created_at"));
+                for(unsigned int field = 1; field <= 8; field++)
+                {
+                    entry.fields[field - 1] = jsonValue(update, String("field") + String(field));
+                }
+                entry.status = jsonValue(update, "status");
+                entry.latitude = jsonValue(update, "latitude");
+                entry.longitude = jsonValue(update, "longitude");
+                entry.elevation = jsonValue(update, "elevation");
+                position = end + 1;
+            }
+            return httpResponse(202, "application/json", "{\"success\":true}");
+        }
+
+        // GET /channels/<channel>/feeds... and /channels/<channel>/fields/<field>...
+        String respondRead(const String & target, const String & query, const String & apiKey)
+        {
+            int channelEnd = target.indexOf('/', 10);
+            emulatedChannel * channel = getChannel(target.substring(10, (channelEnd < 0) ? target.length() : channelEnd).toInt());
+            if(NULL == channel || channelEnd < 0)
+            {
+                return httpResponse(404, "text/plain", "-1");
+            }
+            if(NULL != channel->readAPIKey && apiKey != channel->readAPIKey)
+            {
+                return httpResponse(404, "text/plain", "-1");
+            }
+
+            String path = target.substring(channelEnd);
+            bool withStatus = (formValue(query, "status") == "true");
+            bool withLocation = (formValue(query, "location") == "true");
+            String results = formValue(query, "results");
+            long count = (results.length() > 0) ? results.toInt() : TS_EMULATOR_FEED_LENGTH;
+
+            unsigned int field = 0;
+            if(path.startsWith("/fields/"))
+            {
+                field = path.substring(8).toInt();
+                if(field < 1 || field > 8)
+                {
+                    return httpResponse(400, "text/plain", "-1");
+                }
+                path = path.substring(9);
+            }
+            else if(path.startsWith("/feeds"))
+            {
+                path = path.substring(6);
+            }
+            else
+            {
+                return httpResponse(404, "text/plain", "-1");
+            }
+
+            const emulatedEntry * last = lastEntry(*channel);
+            String body = String("");
+            if(path == "/last" || path == "/last.txt" || path == "/last.json")
+            {
+                if(NULL == last)
+                {
+                    return httpResponse(200, "text/plain", "-1");
+                }
+                if(field != 0 && path != "/last.json")
+                {
+                    // The value alone
+                    return httpResponse(200, "text/plain", last->fields[field - 1]);
+                }
+                printEntryJSON(body, *last, field, withStatus, withLocation);
+                return httpResponse(200, "application/json", body);
+            }
+            if(path == "/last.csv")
+            {
+                if(NULL == last)
+                {
+                    return httpResponse(200, "text/plain", "-1");
+                }
+                printCSVHeader(body, field, withStatus, withLocation);
+                printEntryCSV(body, *last, field, withStatus, withLocation);
+                return httpResponse(200, "text/csv", body);
+            }
+            if(path == ".json" || path == "")
+            {
+                body += "{\"channel\":{\"id\":";
+                body += String(channel->channelNumber);
+                body += ",\"last_entry_id\":";
+                body += String(channel->lastEntryID);
+                body += "},\"feeds\":[";
+                long first = firstEntryID(*channel, count);
+                for(long entryID = first; entryID <= channel->lastEntryID && entryID > 0; entryID++)
+                {
+                    if(entryID != first)
+                    {
+                        body += ",";
+                    }
+                    printEntryJSON(body, entryByID(*channel, entryID), field, withStatus, withLocation);
+                }
+                body += "]}";
+                return httpResponse(200, "application/json", body);
+            }
+            if(path == ".csv")
+            {
+                printCSVHeader(body, field, withStatus, withLocation);
+                for(long entryID = firstEntryID(*channel, count); entryID <= channel->lastEntryID && entryID > 0; entryID++)
+                {
+                    printEntryCSV(body, entryByID(*channel, entryID), field, withStatus, withLocation);
+                }
+                return httpResponse(200, "text/csv", body);
+            }
+            return httpResponse(404, "text/plain", "-1");
+        }
+
+        bool isRateLimited(emulatedChannel & channel)
+        {
+            unsigned long now = millis();
+            if(channel.lastEntryID > 0 && now - channel.lastUpdateAt < this->rateLimitMs)
+            {
+                return true;
+            }
+            channel.lastUpdateAt = now;
+            return false;
+        }
+
+        // Adds an entry to the channel, stamped with createdAt if it can be parsed, else the current time
+        emulatedEntry & storeEntry(emulatedChannel & channel, const String & createdAt)
+        {
+            channel.lastEntryID++;
+            emulatedEntry & entry = channel.entries[(channel.lastEntryID - 1) % TS_EMULATOR_FEED_LENGTH];
+            entry.entryID = channel.lastEntryID;
+            entry.createdAt = parseTimestamp(createdAt);
+            this->entriesStored++;
+            return entry;
+        }
+
+        const emulatedEntry * lastEntry(const emulatedChannel & channel)
+        {
+            return (channel.lastEntryID > 0) ? &entryByID(channel, channel.lastEntryID) : NULL;
+        }
+
+        const emulatedEntry & entryByID(const emulatedChannel & channel, long entryID)
+        {
+            return channel.entries[(entryID - 1) % TS_EMULATOR_FEED_LENGTH];
+        }
+
+        // Oldest entry still kept of the count most recent ones
+        long firstEntryID(const emulatedChannel & channel, long count)
+        {
+            if(count > TS_EMULATOR_FEED_LENGTH)
+            {
+                count = TS_EMULATOR_FEED_LENGTH;
+            }
+            long first = channel.lastEntryID - count + 1;
+            return (first < 1) ? 1 : first;
+        }
+
+        void printEntryJSON(String & out, const emulatedEntry & entry, unsigned int field, bool withStatus, bool withLocation)
+        {
+            char timestamp[32];
+            formatTimestamp(entry.createdAt, "%04d-%02d-%02dT%02d:%02d:%02dZ", timestamp, sizeof(timestamp));
+            out += "{\"created_at\":\"";
+            out += timestamp;
+            out += "\",\"entry_id\":";
+            out += String(entry.entryID);
+            for(unsigned int column = 1; column <= 8; column++)
+            {
+                if(field == 0 || field == column)
+                {
+                    printJSONMember(out, (String("field") + String(column)).c_str(), entry.fields[column - 1]);
+                }
+            }
+            if(withStatus)
+            {
+                printJSONMember(out, "status", entry.status);
+            }
+            if(withLocation)
+            {
+                printJSONMember(out, "latitude", entry.latitude);
+                printJSONMember(out, "longitude", entry.longitude);
+                printJSONMember(out, "elevation", entry.elevation);
+            }
+            out += "}";
+        }
+
+        void printJSONMember(String & out, const char * name, const String & value)
+        {
+            out += ",\"";
+            out += name;
+            out += "\":";
+            if(value.length() == 0)
+            {
+                out += "null";
+                return;
+            }
+            out += "\"";
+            for(unsigned int i = 0; i < value.length(); i++)
+            {
+                char c = value.charAt(i);
+                if(c == '"' || c == '\\')
+                {
+                    out += '\\';
+                }
+                out += c;
+            }
+            out += "\"";
+        }
+
+        // The columns in the order ThingSpeak sends them, location before status
+        void printCSVHeader(String & out, unsigned int field, bool withStatus, bool withLocation)
+        {
+            out += "created_at,entry_id";
+            for(unsigned int column = 1; column <= 8; column++)
+            {
+                if(field == 0 || field == column)
+                {
+                    out += ",field";
+                    out += String(column);
+                }
+            }
+            if(withLocation)
+            {
+                out += ",latitude,longitude,elevation";
+            }
+            if(withStatus)
+            {
+                out += ",status";
+            }
+            out += "\n";
+        }
+
+        void printEntryCSV(String & out, const emulatedEntry & entry, unsigned int field, bool withStatus, bool withLocation)
+        {
+            char timestamp[32];
+            formatTimestamp(entry.createdAt, "%04d-%02d-%02d %02d:%02d:%02d UTC", timestamp, sizeof(timestamp));
+            out += timestamp;
+            out += ",";
+            out += String(entry.entryID);
+            for(unsigned int column = 1; column <= 8; column++)
+            {
+                if(field == 0 || field == column)
+                {
+                    printCSVValue(out, entry.fields[column - 1]);
+                }
+            }
+            if(withLocation)
+            {
+                printCSVValue(out, entry.latitude);
+                printCSVValue(out, entry.longitude);
+                printCSVValue(out, entry.elevation);
+            }
+            if(withStatus)
+            {
+                printCSVValue(out, entry.status);
+            }
+            out += "\n";
+        }
+
+        // Quotes values that hold a separator or a quote, doubling the quotes
+        void printCSVValue(String & out, const String & value)
+        {
+            out += ",";
+            if(value.indexOf(',') < 0 && value.indexOf('"') < 0 && value.indexOf('\n') < 0)
+            {
+                out += value;
+                return;
+            }
+            out += "\"";
+            for(unsigned int i = 0; i < value.length(); i++)
+            {
+                if(value.charAt(i) == '"')
+                {
+                    out += '"';
+                }
+                out += value.charAt(i);
+            }
+            out += "\"";
+        }
+
+        String httpResponse(int status, const char * contentType, const String & body)
+        {
+            const char * reason = "OK";
+            switch(status)
+            {
+                case 202: reason = "Accepted"; break;
+                case 400: reason = "Bad Request"; break;
+                case 401: reason = "Unauthorized"; break;
+                case 404: reason = "Not Found"; break;
+                case 429: reason = "Too Many Requests"; break;
+                case 500: reason = "Internal Server Error"; break;
+            }
+            String response = String("HTTP/1.1 ") + String(status) + String(" ") + String(reason) + String("\r\n");
+            if(Time.isValid())
+            {
+                char date[32];
+                formatHTTPDate(Time.now(), date, sizeof(date));
+                response += String("Date: ") + String(date) + String("\r\n");
+            }
+            response += String("Content-Type: ") + String(contentType) + String("; charset=utf-8\r\n");
+            response += String("Content-Length: ") + String(body.length()) + String("\r\n");
+            response += "Connection: close\r\n\r\n";
+            response += body;
+            return response;
+        }
+
+        // Formats a time with format taking year, month, day, hour, minute and second
+        void formatTimestamp(time_t time, const char * format, char * timestamp, size_t size)
+        {
+            struct tm utc;
+            gmtime_r(&time, &utc);
+            snprintf(timestamp, size, format, utc.tm_year + 1900, utc.tm_mon + 1, utc.tm_mday, utc.tm_hour, utc.tm_min, utc.tm_sec);
+        }
+
+        // Formats a time like the Date header of an HTTP response, "Sun, 06 Nov 1994 08:49:37 GMT"
+        void formatHTTPDate(time_t time, char * date, size_t size)
+        {
+            static const char * const dayNames[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+            static const char * const monthNames[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+            struct tm utc;
+            gmtime_r(&time, &utc);
+            snprintf(date, size, "%s, %02d %s %04d %02d:%02d:%02d GMT", dayNames[utc.tm_wday], utc.tm_mday, monthNames[utc.tm_mon], utc.tm_year + 1900, utc.tm_hour, utc.tm_min, utc.tm_sec);
+        }
+
+        // Reads "YYYY-MM-DD HH:MM:SS" or "YYYY-MM-DDTHH:MM:SSZ" as UTC, the current time if there is none
+        time_t parseTimestamp(const String & timestamp)
+        {
+            int year, month, day, hour, minute, second;
+            if(timestamp.length() == 0 || sscanf(timestamp.c_str(), "%d-%d-%d%*c%d:%d:%d", &year, &month, &day, &hour, &minute, &second) != 6)
+            {
+                return Time.isValid() ? Time.now() : (time_t)(millis() / 1000);
+            }
+            // Days since 1970-01-01 in the proleptic Gregorian calendar
+            year -= (month <= 2);
+            long era = (year >= 0 ? year : year - 399) / 400;
+            long yearOfEra = year - era * 400;
+            long dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+            long days = era * 146097 + yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear - 719468;
+            return (time_t)(days * 86400L + hour * 3600L + minute * 60L + second);
+        }
+
+        // Value of a header, name in lower case, empty if it is missing
+        String headerValue(const String & headers, const char * name)
+        {
+            String lines = String("\r\n") + headers;
+            String lowerLines = lines;
+            lowerLines.toLowerCase();
+            int position = lowerLines.indexOf(String("\r\n") + String(name) + String(":"));
+            if(position < 0)
+            {
+                return String("");
+            }
+            int start = position + 2 + strlen(name) + 1;
+            String value = lines.substring(start, lines.indexOf("\r\n", start));
+            value.trim();
+            return value;
+        }
+
+        // Decoded value of name in a URL encoded form or query, empty if it is missing
+        String formValue(const String & form, const String & name)
+        {
+            unsigned int position = 0;
+            while(position < form.length())
+            {
+                int end = form.indexOf('&', position);
+                if(end < 0)
+                {
+                    end = form.length();
+                }
+                int equals = form.indexOf('=', position);
+                if(equals >= 0 && equals < end && form.substring(position, equals) == name)
+                {
+                    String value = String("");
+                    for(int i = equals + 1; i < end; i++)
+                    {
+                        char c = form.charAt(i);
+                        if(c == '+')
+                        {
+                            c = ' ';
+                        }
+                        else if(c == '%' && i + 2 < end + 1)
+                        {
+                            c = (char)strtol(form.substring(i + 1, i + 3).c_str(), NULL, 16);
+                            i += 2;
+                        }
+                        value += c;
+                    }
+                    return value;
+                }
+                position = end + 1;
+            }
+            return String("");
+        }
+
+        // Value of a string or number member of a flat JSON object, empty if it is missing or null
+        String jsonValue(const String & json, const String & name)
+        {
+            int position = json.indexOf(String("\"") + name + String("\""));
+            if(position < 0)
+            {
+                return String("");
+            }
+            position = json.indexOf(':', position + name.length() + 2);
+            if(position < 0)
+            {
+                return String("");
+            }
+            position++;
+            while(position < (int)json.length() && json.charAt(position) == ' ')
+            {
+                position++;
+            }
+            String value = String("");
+            if(json.charAt(position) == '"')
+            {
+                for(position++; position < (int)json.length() && json.charAt(position) != '"'; position++)
+                {
+                    if(json.charAt(position) == '\\')
+                    {
+                        position++;
+                    }
+                    value += json.charAt(position);
+                }
+                return value;
+            }
+            while(position < (int)json.length() && json.charAt(position) != ',' && json.charAt(position) != '}')
+            {
+                value += json.charAt(position++);
+            }
+            value.trim();
+            return (value == "null") ? String("") : value;
+        }
+
+        bool chance(unsigned int percent)
+        {
+            return percent > 0 && (unsigned int)random(100) < percent;
+        }
+
+        emulatedChannel channels[TS_EMULATOR_CHANNELS];
+        unsigned long minLatencyMs;
+        unsigned long maxLatencyMs;
+        unsigned int connectFailPercent;
+        unsigned int errorPercent;
+        unsigned int dropPercent;
+        unsigned long rateLimitMs;
+        unsigned long connections;
+        unsigned long refusedConnections;
+        unsigned long requests;
+        unsigned long entriesStored;
+        unsigned long rateLimited;
+        unsigned long errors;
+        unsigned long dropped;
+    };
+
+    // Client that sends its requests to a ThingSpeakEmulator instead of the network
+    class ThingSpeakEmulatedClient : public Client
+    {
+      public:
+        ThingSpeakEmulatedClient()
+        {
+            this->server = NULL;
+            this->open = false;
+            this->answered = false;
+            this->dropped = false;
+            this->position = 0;
+            this->readyAt = 0;
+        }
+
+        void attach(ThingSpeakEmulator * server)
+        {
+            this->server = server;
+        }
+
+        int connect(IPAddress, uint16_t, network_interface_t = 0) override
+        {
+            return openConnection();
+        }
+
+        int connect(const char *, uint16_t, network_interface_t = 0) override
+        {
+            return openConnection();
+        }
+
+        size_t write(uint8_t b)
+        {
+            return write(&b, 1);
+        }
+
+        size_t write(const uint8_t * buffer, size_t size)
+        {
+            if(!this->open)
+            {
+                return 0;
+            }
+            this->request.reserve(this->request.length() + size);
+            for(size_t i = 0; i < size; i++)
+            {
+                this->request += (char)buffer[i];
+            }
+            checkRequest();
+            return size;
+        }
+
+        int available()
+        {
+            return isReady() ? (int)(this->response.length() - this->position) : 0;
+        }
+
+        int read()
+        {
+            if(available() <= 0)
+            {
+                return -1;
+            }
+            return (uint8_t)this->response.charAt(this->position++);
+        }
+
+        int read(uint8_t * buffer, size_t size)
+        {
+            size_t length = 0;
+            while(length < size && available() > 0)
+            {
+                buffer[length++] = (uint8_t)this->response.charAt(this->position++);
+            }
+            return (length > 0) ? (int)length : -1;
+        }
+
+        int peek()
+        {
+            return (available() > 0) ? (uint8_t)this->response.charAt(this->position) : -1;
+        }
+
+        void flush()
+        {
+        }
+
+        void stop()
+        {
+            this->open = false;
+            this->request = "";
+            this->response = "";
+            this->answered = false;
+            this->dropped = false;
+            this->position = 0;
+        }
+
+        // The emulator closes the connection once the whole response is read, like Connection: close
+        uint8_t connected()
+        {
+            return this->open && !(isReady() && this->position >= this->response.length());
+        }
+
+        operator bool()
+        {
+            return this->open;
+        }
+
+        using Print::write;
+
+      private:
+        int openConnection()
+        {
+            stop();
+            if(NULL == this->server || !this->server->acceptConnection())
+            {
+                return 0;
+            }
+            this->open = true;
+            return 1;
+        }
+
+        // Hands the request to the emulator once its headers and Content-Length bytes of body are written
+        void checkRequest()
+        {
+            if(this->answered || this->dropped)
+            {
+                return;
+            }
+            int headersEnd = this->request.indexOf("\r\n\r\n");
+            if(headersEnd < 0)
+            {
+                return;
+            }
+            String headers = this->request.substring(0, headersEnd);
+            headers.toLowerCase();
+            int lengthHeader = headers.indexOf("content-length:");
+            long contentLength = (lengthHeader < 0) ? 0 : headers.substring(lengthHeader + 15).toInt();
+            if((long)this->request.length() - headersEnd - 4 < contentLength)
+            {
+                return;
+            }
+            this->answered = this->server->respond(this->request, this->response);
+            this->dropped = !this->answered;
+            this->readyAt = millis() + this->server->pickLatency();
+        }
+
+        bool isReady()
+        {
+            return this->open && this->answered && (long)(millis() - this->readyAt) >= 0;
+        }
+
+        ThingSpeakEmulator * server;
+        bool open;
+        bool answered;
+        bool dropped;                          // The emulator will never answer this request
+        String request;
+        String response;
+        unsigned int position;
+        unsigned long readyAt;                 // millis() when the response arrives
+    };
+
+#endif //ThingSpeakEmulator_h
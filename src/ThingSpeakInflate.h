@@ -0,0 +1,494 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  Streaming gzip decoder used for compressed responses (see TS_GZIP_RESPONSES in ThingSpeak.h).
+  Compressed bytes are pulled from a source one at a time and the decoded bytes are kept only in a fixed window,
+  which is handed to the output each time it fills.
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#ifndef ThingSpeakInflate_h
+    #define ThingSpeakInflate_h
+
+    #include "application.h"
+
+    #define TS_INFLATE_OK              0
+    #define TS_INFLATE_END_OF_INPUT    -1      // The source ended before the end of the stream
+    #define TS_INFLATE_BAD_HEADER      -2      // Not a gzip stream using deflate
+    #define TS_INFLATE_BAD_DATA        -3      // Invalid deflate block
+    #define TS_INFLATE_BAD_DISTANCE    -4      // Back reference beyond the data decoded so far, or beyond the window
+    #define TS_INFLATE_BAD_CHECK       -5      // CRC-32 or length in the gzip trailer does not match
+
+    #define TS_INFLATE_MAXBITS         15      // Longest Huffman code
+    #define TS_INFLATE_MAXLCODES       286     // Literal/length codes
+    #define TS_INFLATE_MAXDCODES       30      // Distance codes
+    #define TS_INFLATE_FIXLCODES       288     // Literal/length codes of the fixed code
+
+    // Canonical Huffman code: number of codes of each length, and the symbols ordered by code
+    typedef struct inflateHuffmanRecord
+    {
+        uint16_t count[TS_INFLATE_MAXBITS + 1];
+        uint16_t * symbol;
+    }inflateHuffman;
+
+    // Decodes a gzip stream.  WINDOW_SIZE must be a power of two, and 32768 to decode any stream.
+    // SOURCE is any class with an int read() method that returns the next byte, or -1 at the end of the input.
+    template <size_t WINDOW_SIZE>
+    class ThingSpeakInflater
+    {
+      public:
+        ThingSpeakInflater()
+        {
+            static_assert(WINDOW_SIZE >= 256 && (WINDOW_SIZE & (WINDOW_SIZE - 1)) == 0, "TS_INFLATE_WINDOW_SIZE must be a power of two");
+            this->lengthCode.symbol = this->lengthSymbols;
+            this->distanceCode.symbol = this->distanceSymbols;
+        }
+
+        // Decodes the whole stream from source into out, returns TS_INFLATE_OK or one of the TS_INFLATE_* errors
+        template <class SOURCE>
+        int gunzip(SOURCE & source, Print & out)
+        {
+            this->out = &out;
+            this->bitBuffer = 0;
+            this->bitCount = 0;
+            this->position = 0;
+            this->flushed = 0;
+            this->total = 0;
+            this->crc = 0xFFFFFFFFul;
+            this->error = TS_INFLATE_OK;
+
+            int result = readHeader(source);
+            if(result != TS_INFLATE_OK)
+            {
+                return result;
+            }
+
+            int last;
+            do
+            {
+                last = bits(source, 1);
+                int type = bits(source, 2);
+                if(this->error != TS_INFLATE_OK)
+                {
+                    return this->error;
+                }
+                if(type == 0)
+                {
+                    result = storedBlock(source);
+                }
+                else if(type == 1)
+                {
+                    result = fixedBlock(source);
+                }
+                else if(type == 2)
+                {
+                    result = dynamicBlock(source);
+                }
+                else
+                {
+                    result = TS_INFLATE_BAD_DATA;
+                }
+                if(result != TS_INFLATE_OK)
+                {
+                    return result;
+                }
+            } while(!last);
+            flush();
+
+            // The trailer starts on a byte boundary
+            this->bitBuffer = 0;
+            this->bitCount = 0;
+            unsigned long expectedCRC = bits(source, 16);
+            expectedCRC |= (unsigned long)bits(source, 16) << 16;
+            unsigned long expectedSize = bits(source, 16);
+            expectedSize |= (unsigned long)bits(source, 16) << 16;
+            if(this->error != TS_INFLATE_OK)
+            {
+                return this->error;
+            }
+            if(expectedCRC != (this->crc ^ 0xFFFFFFFFul) || expectedSize != (this->total & 0xFFFFFFFFul))
+            {
+                return TS_INFLATE_BAD_CHECK;
+            }
+            return TS_INFLATE_OK;
+        }
+
+        // Number of bytes decoded by the last call to gunzip()
+        unsigned long getDecodedLength() const
+        {
+            return this->total;
+        }
+
+      private:
+        template <class SOURCE>
+        int readHeader(SOURCE & source)
+        {
+            if(bits(source, 8) != 0x1F || bits(source, 8) != 0x8B || bits(source, 8) != 8)
+            {
+                return (this->error != TS_INFLATE_OK) ? this->error : TS_INFLATE_BAD_HEADER;
+            }
+            int flags = bits(source, 8);
+            // Modification time, extra flags and operating system
+            for(int i = 0; i < 6; i++)
+            {
+                bits(source, 8);
+            }
+            if(flags & 0x04)
+            {
+                // FEXTRA
+                int length = bits(source, 16);
+                while(length-- > 0 && this->error == TS_INFLATE_OK)
+                {
+                    bits(source, 8);
+                }
+            }
+            if(flags & 0x08)
+            {
+                // FNAME, zero terminated
+                while(bits(source, 8) != 0 && this->error == TS_INFLATE_OK);
+            }
+            if(flags & 0x10)
+            {
+                // FCOMMENT, zero terminated
+                while(bits(source, 8) != 0 && this->error == TS_INFLATE_OK);
+            }
+            if(flags & 0x02)
+            {
+                // FHCRC
+                bits(source, 16);
+            }
+            return this->error;
+        }
+
+        // Takes need bits from the source, least significant first
+        template <class SOURCE>
+        int bits(SOURCE & source, int need)
+        {
+            while(this->bitCount < need)
+            {
+                int next = source.read();
+                if(next < 0)
+                {
+                    this->error = TS_INFLATE_END_OF_INPUT;
+                    return 0;
+                }
+                this->bitBuffer |= (unsigned long)next << this->bitCount;
+                this->bitCount += 8;
+            }
+            int value = (int)(this->bitBuffer & ((1ul << need) - 1));
+            this->bitBuffer >>= need;
+            this->bitCount -= need;
+            return value;
+        }
+
+        template <class SOURCE>
+        int storedBlock(SOURCE & source)
+        {
+            // Stored blocks start on a byte boundary
+            this->bitBuffer = 0;
+            this->bitCount = 0;
+            unsigned int length = bits(source, 16);
+            unsigned int complement = bits(source, 16);
+            if(this->error != TS_INFLATE_OK)
+            {
+                return this->error;
+            }
+            if(length != (~complement & 0xFFFFu))
+            {
+                return TS_INFLATE_BAD_DATA;
+            }
+            while(length-- > 0)
+            {
+                int next = source.read();
+                if(next < 0)
+                {
+                    return TS_INFLATE_END_OF_INPUT;
+                }
+                put((uint8_t)next);
+            }
+            return TS_INFLATE_OK;
+        }
+
+        template <class SOURCE>
+        int fixedBlock(SOURCE & source)
+        {
+            uint8_t lengths[TS_INFLATE_FIXLCODES];
+            int symbol;
+            for(symbol = 0; symbol < 144; symbol++) lengths[symbol] = 8;
+            for(; symbol < 256; symbol++) lengths[symbol] = 9;
+            for(; symbol < 280; symbol++) lengths[symbol] = 7;
+            for(; symbol < TS_INFLATE_FIXLCODES; symbol++) lengths[symbol] = 8;
+            buildCode(this->lengthCode, lengths, TS_INFLATE_FIXLCODES);
+            for(symbol = 0; symbol < TS_INFLATE_MAXDCODES; symbol++) lengths[symbol] = 5;
+            buildCode(this->distanceCode, lengths, TS_INFLATE_MAXDCODES);
+            return codes(source);
+        }
+
+        template <class SOURCE>
+        int dynamicBlock(SOURCE & source)
+        {
+            static const uint8_t order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+            uint8_t lengths[TS_INFLATE_MAXLCODES + TS_INFLATE_MAXDCODES];
+
+            int lengthCount = bits(source, 5) + 257;
+            int distanceCount = bits(source, 5) + 1;
+            int codeCount = bits(source, 4) + 4;
+            if(this->error != TS_INFLATE_OK)
+            {
+                return this->error;
+            }
+            if(lengthCount > TS_INFLATE_MAXLCODES || distanceCount > TS_INFLATE_MAXDCODES)
+            {
+                return TS_INFLATE_BAD_DATA;
+            }
+
+            // The code lengths are themselves Huffman coded, the code lengths of that code come first
+            int index;
+            for(index = 0; index < codeCount; index++)
+            {
+                lengths[order[index]] = bits(source, 3);
+            }
+            for(; index < 19; index++)
+            {
+                lengths[order[index]] = 0;
+            }
+            if(buildCode(this->lengthCode, lengths, 19) != 0)
+            {
+                return TS_INFLATE_BAD_DATA;
+            }
+
+            index = 0;
+            while(index < lengthCount + distanceCount)
+            {
+                int symbol = decode(source, this->lengthCode);
+                if(symbol < 0)
+                {
+                    return (this->error != TS_INFLATE_OK) ? this->error : TS_INFLATE_BAD_DATA;
+                }
+                if(symbol < 16)
+                {
+                    lengths[index++] = symbol;
+                    continue;
+                }
+                int repeat;
+                uint8_t length = 0;
+                if(symbol == 16)
+                {
+                    if(index == 0)
+                    {
+                        return TS_INFLATE_BAD_DATA;
+                    }
+                    length = lengths[index - 1];
+                    repeat = 3 + bits(source, 2);
+                }
+                else if(symbol == 17)
+                {
+                    repeat = 3 + bits(source, 3);
+                }
+                else
+                {
+                    repeat = 11 + bits(source, 7);
+                }
+                if(index + repeat > lengthCount + distanceCount)
+                {
+                    return TS_INFLATE_BAD_DATA;
+                }
+                while(repeat-- > 0)
+                {
+                    lengths[index++] = length;
+                }
+            }
+            if(this->error != TS_INFLATE_OK)
+            {
+                return this->error;
+            }
+            if(lengths[256] == 0)
+            {
+                // No end-of-block code
+                return TS_INFLATE_BAD_DATA;
+            }
+
+            // Incomplete codes are only allowed for a single length or distance code
+            int left = buildCode(this->lengthCode, lengths, lengthCount);
+            if(left < 0 || (left > 0 && lengthCount - this->lengthCode.count[0] != 1))
+            {
+                return TS_INFLATE_BAD_DATA;
+            }
+            left = buildCode(this->distanceCode, lengths + lengthCount, distanceCount);
+            if(left < 0 || (left > 0 && distanceCount - this->distanceCode.count[0] != 1))
+            {
+                return TS_INFLATE_BAD_DATA;
+            }
+            return codes(source);
+        }
+
+        // Decodes literals and length/distance pairs until the end of the block
+        template <class SOURCE>
+        int codes(SOURCE & source)
+        {
+            static const uint16_t lengthBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+            static const uint8_t lengthExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+            static const uint16_t distanceBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+            static const uint8_t distanceExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+            while(true)
+            {
+                int symbol = decode(source, this->lengthCode);
+                if(symbol < 0)
+                {
+                    return (this->error != TS_INFLATE_OK) ? this->error : TS_INFLATE_BAD_DATA;
+                }
+                if(symbol < 256)
+                {
+                    put((uint8_t)symbol);
+                    continue;
+                }
+                if(symbol == 256)
+                {
+                    return this->error;
+                }
+
+                symbol -= 257;
+                if(symbol >= 29)
+                {
+                    return TS_INFLATE_BAD_DATA;
+                }
+                unsigned int length = lengthBase[symbol] + bits(source, lengthExtra[symbol]);
+                symbol = decode(source, this->distanceCode);
+                if(symbol < 0 || symbol >= 30)
+                {
+                    return (this->error != TS_INFLATE_OK) ? this->error : TS_INFLATE_BAD_DATA;
+                }
+                unsigned long distance = distanceBase[symbol] + bits(source, distanceExtra[symbol]);
+                if(this->error != TS_INFLATE_OK)
+                {
+                    return this->error;
+                }
+                if(distance > this->total || distance > WINDOW_SIZE)
+                {
+                    return TS_INFLATE_BAD_DISTANCE;
+                }
+                while(length-- > 0)
+                {
+                    put(this->window[(this->position - distance) & (WINDOW_SIZE - 1)]);
+                }
+            }
+        }
+
+        // Decodes one symbol a bit at a time, slow but needs no lookup tables
+        template <class SOURCE>
+        int decode(SOURCE & source, const inflateHuffman & code)
+        {
+            int value = 0;
+            int first = 0;
+            int index = 0;
+            for(int length = 1; length <= TS_INFLATE_MAXBITS; length++)
+            {
+                value |= bits(source, 1);
+                if(this->error != TS_INFLATE_OK)
+                {
+                    return -1;
+                }
+                int count = code.count[length];
+                if(value - count < first)
+                {
+                    return code.symbol[index + (value - first)];
+                }
+                index += count;
+                first += count;
+                first <<= 1;
+                value <<= 1;
+            }
+            return -1;
+        }
+
+        // Builds a canonical code from code lengths, returns 0 if complete, > 0 if incomplete, < 0 if oversubscribed
+        int buildCode(inflateHuffman & code, const uint8_t * lengths, int n)
+        {
+            for(int length = 0; length <= TS_INFLATE_MAXBITS; length++)
+            {
+                code.count[length] = 0;
+            }
+            for(int symbol = 0; symbol < n; symbol++)
+            {
+                code.count[lengths[symbol]]++;
+            }
+            if(code.count[0] == n)
+            {
+                return 0;
+            }
+
+            int left = 1;
+            for(int length = 1; length <= TS_INFLATE_MAXBITS; length++)
+            {
+                left <<= 1;
+                left -= code.count[length];
+                if(left < 0)
+                {
+                    return left;
+                }
+            }
+
+            uint16_t offsets[TS_INFLATE_MAXBITS + 1];
+            offsets[1] = 0;
+            for(int length = 1; length < TS_INFLATE_MAXBITS; length++)
+            {
+                offsets[length + 1] = offsets[length] + code.count[length];
+            }
+            for(int symbol = 0; symbol < n; symbol++)
+            {
+                if(lengths[symbol] != 0)
+                {
+                    code.symbol[offsets[lengths[symbol]]++] = symbol;
+                }
+            }
+            return left;
+        }
+
+        void put(uint8_t value)
+        {
+            this->crc ^= value;
+            for(int bit = 0; bit < 8; bit++)
+            {
+                this->crc = (this->crc >> 1) ^ (0xEDB88320ul & (0ul - (this->crc & 1)));
+            }
+            this->window[this->position & (WINDOW_SIZE - 1)] = value;
+            this->position++;
+            this->total++;
+            if((this->position & (WINDOW_SIZE - 1)) == 0)
+            {
+                flush();
+            }
+        }
+
+        // Hands the bytes decoded since the last flush to the output
+        void flush()
+        {
+            size_t start = this->flushed & (WINDOW_SIZE - 1);
+            size_t length = this->position - this->flushed;
+            if(length > 0)
+            {
+                this->out->write(this->window + start, length);
+            }
+            this->flushed = this->position;
+        }
+
+        uint8_t window[WINDOW_SIZE];
+        uint16_t lengthSymbols[TS_INFLATE_FIXLCODES];
+        uint16_t distanceSymbols[TS_INFLATE_MAXDCODES];
+        inflateHuffman lengthCode;
+        inflateHuffman distanceCode;
+        Print * out;
+        unsigned long bitBuffer;
+        int bitCount;
+        unsigned long position;                // Bytes decoded, wraps around the window
+        unsigned long flushed;                 // Bytes handed to the output
+        unsigned long total;
+        unsigned long crc;
+        int error;
+    };
+
+#endif //ThingSpeakInflate_h
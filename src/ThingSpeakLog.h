@@ -0,0 +1,222 @@
+/*
+  ThingSpeak(TM) Communication Library For Particle
+
+  Event log for the library.  Each event is stored as a fixed-size binary record in a RAM ring, so logging
+  costs a few stores and never blocks, formats text, or touches the network.  Levels above TS_LOG_LEVEL
+  compile to nothing, including their arguments.  Records are formatted only when they are dumped.
+
+  Copyright 2020-2025, The MathWorks, Inc.
+
+  See the accompanying license file for licensing information.
+*/
+
+#ifndef ThingSpeakLog_h
+    #define ThingSpeakLog_h
+
+    #include "application.h"
+    #include <atomic>
+
+    #define TS_LOG_LEVEL_NONE          0
+    #define TS_LOG_LEVEL_ERROR         1       // Failed connections and responses
+    #define TS_LOG_LEVEL_WARN          2       // Timeouts
+    #define TS_LOG_LEVEL_INFO          3       // Library calls and their results
+    #define TS_LOG_LEVEL_TRACE         4       // Each step of a request
+
+    #ifndef TS_LOG_LEVEL
+        #if defined(PRINT_DEBUG_MESSAGES) || defined(PRINT_HTTP)
+            #define TS_LOG_LEVEL       TS_LOG_LEVEL_TRACE
+        #else
+            #define TS_LOG_LEVEL       TS_LOG_LEVEL_NONE
+        #endif
+    #endif
+
+    #ifndef TS_LOG_LENGTH
+        #define TS_LOG_LENGTH          32      // Records kept, must be a power of two
+    #endif
+
+    // Events, the meaning of the two arguments is in the comment
+    #define TS_EVENT_BEGIN             0       // -, -
+    #define TS_EVENT_WRITE_FIELD       1       // channel, field
+    #define TS_EVENT_SET_FIELD         2       // field, -
+    #define TS_EVENT_SET_LOCATION      3       // 0 latitude, 1 longitude, 2 elevation; value x 1000
+    #define TS_EVENT_SET_STATUS        4       // length, -
+    #define TS_EVENT_SET_CREATED_AT    5       // length, -
+    #define TS_EVENT_WRITE_RAW         6       // channel, message length
+    #define TS_EVENT_READ_FIELD        7       // channel, field
+    #define TS_EVENT_READ_RAW          8       // channel, URL suffix length
+    #define TS_EVENT_READ_SELECTED     9       // channel, selection
+    #define TS_EVENT_POST              10      // channel, body length
+    #define TS_EVENT_ENTRY_ID          11      // channel, entry ID
+    #define TS_EVENT_CONNECT           12      // port, -
+    #define TS_EVENT_CONNECTED         13      // port, 1 if the connection opened by prepare() was used
+    #define TS_EVENT_CONNECT_FAILED    14      // port, -
+    #define TS_EVENT_HTTP_STATUS       15      // status, -
+    #define TS_EVENT_TIMEOUT           16      // milliseconds waited, -
+    #define TS_EVENT_BAD_RESPONSE      17      // 1 no status line, 2 status line not ended, 3 headers not ended, 4 no heap for the decoder
+    #define TS_EVENT_RESPONSE          18      // status, length
+    #define TS_EVENT_DISCONNECTED      19      // -, -
+    #define TS_EVENT_ABORT             20      // 0 read, 1 write
+    #define TS_EVENT_CIRCUIT_OPEN      21      // port, milliseconds until the next probe
+    #define TS_EVENT_BUDGET_EXCEEDED   22      // governor level, bytes used in the period
+    #define TS_EVENT_WRITE_REAPED      23      // status, entry ID; status -304 if no response had arrived
+    #define TS_EVENT_COUNT             24
+
+    // One logged event
+    typedef struct logRecordRecord
+    {
+        uint32_t time;         // millis()
+        uint8_t level;
+        uint8_t event;
+        uint16_t sequence;     // Low bits of the record number, shows where records were overwritten
+        int32_t a;
+        int32_t b;
+    }logRecord;
+
+    // One slot of the ring.  The fields are atomic so a record being overwritten can be detected instead of read torn.
+    typedef struct logSlotRecord
+    {
+        std::atomic<unsigned int> published;   // Record number + 1 once the record is written, 0 while it is being written
+        std::atomic<uint32_t> time;
+        std::atomic<uint16_t> kind;            // Level in the low byte, event in the high byte
+        std::atomic<int32_t> a;
+        std::atomic<int32_t> b;
+    }logSlot;
+
+    // Ring of the most recent log records.  Any thread or ISR may record; only one thread should drain or dump.
+    // Each slot is published with its record number after its fields are written, and drain() only takes a slot
+    // whose number is the next one expected: it stops at a record still being written, and skips a record that
+    // was overwritten before or while it was read.
+    template <unsigned int LENGTH>
+    class ThingSpeakLog
+    {
+      public:
+        ThingSpeakLog()
+        {
+            static_assert(LENGTH > 0 && (LENGTH & (LENGTH - 1)) == 0, "TS_LOG_LENGTH must be a power of two");
+            for(unsigned int i = 0; i < LENGTH; i++)
+            {
+                this->slots[i].published.store(0);
+            }
+            this->head.store(0);
+            this->tail = 0;
+        }
+
+        void record(uint8_t level, uint8_t event, long a, long b)
+        {
+            unsigned int index = this->head.fetch_add(1, std::memory_order_relaxed);
+            logSlot & slot = this->slots[index % LENGTH];
+            // Mark the slot as being written before any field changes, so a drain reading it sees the change
+            slot.published.store(0, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.time.store(millis(), std::memory_order_relaxed);
+            slot.kind.store((uint16_t)(level | (event << 8)), std::memory_order_relaxed);
+            slot.a.store(a, std::memory_order_relaxed);
+            slot.b.store(b, std::memory_order_relaxed);
+            slot.published.store(index + 1, std::memory_order_release);
+        }
+
+        // Takes the oldest record not drained yet, records that were overwritten are skipped
+        bool drain(logRecord & entry)
+        {
+            while(true)
+            {
+                unsigned int head = this->head.load(std::memory_order_acquire);
+                if(head - this->tail > LENGTH)
+                {
+                    this->tail = head - LENGTH;
+                }
+                if(this->tail == head)
+                {
+                    return false;
+                }
+
+                logSlot & slot = this->slots[this->tail % LENGTH];
+                unsigned int published = slot.published.load(std::memory_order_acquire);
+                if(published != this->tail + 1)
+                {
+                    if(published == 0 || (int)(published - (this->tail + 1)) < 0)
+                    {
+                        // Claimed but not written yet, the next drain takes it
+                        return false;
+                    }
+                    // Already overwritten by a newer record
+                    this->tail++;
+                    continue;
+                }
+
+                entry.time = slot.time.load(std::memory_order_relaxed);
+                uint16_t kind = slot.kind.load(std::memory_order_relaxed);
+                entry.a = slot.a.load(std::memory_order_relaxed);
+                entry.b = slot.b.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                bool unchanged = (slot.published.load(std::memory_order_relaxed) == published);
+                this->tail++;
+                if(unchanged)
+                {
+                    entry.level = kind & 0xFF;
+                    entry.event = kind >> 8;
+                    entry.sequence = (uint16_t)(published - 1);
+                    return true;
+                }
+                // Overwritten while it was read
+            }
+        }
+
+        // Formats the records not drained yet, one per line
+        size_t dump(Print & out)
+        {
+            static const char * const levelNames[] = {"", "ERROR", "WARN", "INFO", "TRACE"};
+            static const char * const eventNames[TS_EVENT_COUNT] = {"begin", "writeField", "setField", "setLocation", "setStatus", "setCreatedAt", "writeRaw",
+                                                                    "readField", "readRaw", "readSelected", "post", "entryID", "connect", "connected",
+                                                                    "connectFailed", "httpStatus", "timeout", "badResponse", "response", "disconnected", "abort",
+                                                                    "circuitOpen", "budgetExceeded", "writeReaped"};
+            size_t written = 0;
+            logRecord entry;
+            while(drain(entry))
+            {
+                written += out.print(entry.time);
+                written += out.print(" ");
+                written += out.print(entry.sequence);
+                written += out.print(" ");
+                written += out.print(entry.level <= TS_LOG_LEVEL_TRACE ? levelNames[entry.level] : "?");
+                written += out.print(" ");
+                written += out.print(entry.event < TS_EVENT_COUNT ? eventNames[entry.event] : "?");
+                written += out.print(" ");
+                written += out.print((long)entry.a);
+                written += out.print(" ");
+                written += out.println((long)entry.b);
+            }
+            return written;
+        }
+
+      private:
+        logSlot slots[LENGTH];
+        std::atomic<unsigned int> head;        // Records made
+        unsigned int tail;                     // Records drained, only used by the draining thread
+    };
+
+    // Logging inside ThingSpeakClass, levels above TS_LOG_LEVEL do not evaluate their arguments.
+    // They are still named in an unevaluated sizeof, so values only passed to the log are not reported as unused.
+    #define TS_LOG_UNUSED(a, b)        ((void)sizeof((long)(a) + (long)(b)))
+    #if TS_LOG_LEVEL >= TS_LOG_LEVEL_ERROR
+        #define TS_LOG_ERROR(event, a, b)  this->eventLog.record(TS_LOG_LEVEL_ERROR, (event), (long)(a), (long)(b))
+    #else
+        #define TS_LOG_ERROR(event, a, b)  TS_LOG_UNUSED(a, b)
+    #endif
+    #if TS_LOG_LEVEL >= TS_LOG_LEVEL_WARN
+        #define TS_LOG_WARN(event, a, b)   this->eventLog.record(TS_LOG_LEVEL_WARN, (event), (long)(a), (long)(b))
+    #else
+        #define TS_LOG_WARN(event, a, b)   TS_LOG_UNUSED(a, b)
+    #endif
+    #if TS_LOG_LEVEL >= TS_LOG_LEVEL_INFO
+        #define TS_LOG_INFO(event, a, b)   this->eventLog.record(TS_LOG_LEVEL_INFO, (event), (long)(a), (long)(b))
+    #else
+        #define TS_LOG_INFO(event, a, b)   TS_LOG_UNUSED(a, b)
+    #endif
+    #if TS_LOG_LEVEL >= TS_LOG_LEVEL_TRACE
+        #define TS_LOG_TRACE(event, a, b)  this->eventLog.record(TS_LOG_LEVEL_TRACE, (event), (long)(a), (long)(b))
+    #else
+        #define TS_LOG_TRACE(event, a, b)  TS_LOG_UNUSED(a, b)
+    #endif
+
+#endif //ThingSpeakLog_h